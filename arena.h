@@ -0,0 +1,172 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// Mémoire de travail d'une exécution de la simulation. Les tableaux sont
+// découpés les uns après les autres dans de grands blocs, sans libération
+// individuelle, et reset() rend tout d'un coup en O(1). Les blocs sont gardés
+// pour l'exécution suivante : si la précédente en a rempli plusieurs, ils sont
+// remplacés par un seul de leur taille totale, si bien qu'une suite
+// d'exécutions semblables n'alloue plus rien après la première. Réservée aux
+// types sans destructeur (identifiants, compteurs).
+class Arena {
+private:
+    static constexpr size_t minBlock = size_t(1) << 16; // Octets
+
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t current = 0; // Bloc en cours de découpe
+    size_t offset = 0;  // Octets déjà découpés dans ce bloc
+
+    void addBlock(size_t size) {
+        blocks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[size]), size});
+    }
+
+public:
+    Arena() = default;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // `alignment` est une puissance de deux, au plus celui de max_align_t
+    void* allocate(size_t bytes, size_t alignment) {
+        for (; current < blocks.size(); ++current, offset = 0) {
+            size_t start = (offset + alignment - 1) & ~(alignment - 1);
+            if (start <= blocks[current].size && bytes <= blocks[current].size - start) {
+                offset = start + bytes;
+                return blocks[current].data.get() + start;
+            }
+        }
+        // Chaque nouveau bloc double au moins la capacité totale
+        addBlock(std::max({minBlock, bytes, 2 * (blocks.empty() ? 0 : blocks.back().size)}));
+        offset = bytes;
+        return blocks[current].data.get();
+    }
+
+    // Tableau de `n` valeurs non initialisées
+    template <typename T>
+    T* allocate(size_t n) {
+        static_assert(std::is_trivially_destructible<T>::value, "l'arène ne détruit pas ses objets");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "alignement non pris en charge");
+        return static_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // Tableau de `n` cases à `value`
+    template <typename T>
+    T* fill(size_t n, T value) {
+        T* array = allocate<T>(n);
+        std::uninitialized_fill_n(array, n, value);
+        return array;
+    }
+
+    // Rend toute la mémoire découpée ; les pointeurs obtenus avant ne sont plus valides
+    void reset() {
+        if (blocks.size() > 1) {
+            size_t total = 0;
+            for (const Block& block : blocks)
+                total += block.size;
+            blocks.clear();
+            addBlock(total);
+        }
+        current = 0;
+        offset = 0;
+    }
+
+    // Octets réservés dans les blocs
+    size_t capacity() const {
+        size_t total = 0;
+        for (const Block& block : blocks)
+            total += block.size;
+        return total;
+    }
+};
+
+// Allocateur des conteneurs standard : dans l'arène si elle est donnée, la
+// libération est alors sans effet et tout part au prochain reset(), sinon sur
+// le tas comme std::allocator. Un conteneur qui grandit dans l'arène y laisse
+// ses anciens tableaux jusqu'au reset() : au plus le double de sa taille finale.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    Arena* arena = nullptr;
+
+    ArenaAllocator() = default;
+
+    explicit ArenaAllocator(Arena* a) : arena(a) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        return arena != nullptr ? arena->allocate<T>(n) : std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (arena == nullptr)
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const {
+        return arena != other.arena;
+    }
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Tableau fixe de `n` objets construits dans l'arène avec les mêmes arguments,
+// pour les types qu'un ArenaVector ne peut pas contenir (non déplaçables, comme
+// les files des prêts). Les objets sont détruits avec le tableau, leur mémoire
+// part au reset() de l'arène.
+template <typename T>
+class ArenaObjects {
+private:
+    T* items;
+    size_t count = 0;
+
+public:
+    template <typename... Args>
+    ArenaObjects(Arena& arena, size_t n, Args&... args)
+        : items(static_cast<T*>(arena.allocate(n * sizeof(T), alignof(T)))) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "alignement non pris en charge");
+        try {
+            for (; count < n; ++count)
+                new (items + count) T(args...);
+        } catch (...) {
+            this->~ArenaObjects();
+            throw;
+        }
+    }
+
+    ~ArenaObjects() {
+        while (count > 0)
+            items[--count].~T();
+    }
+
+    ArenaObjects(const ArenaObjects&) = delete;
+    ArenaObjects& operator=(const ArenaObjects&) = delete;
+
+    T& operator[](size_t i) {
+        return items[i];
+    }
+};
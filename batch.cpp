@@ -0,0 +1,817 @@
+// Ordonnanceur en mode batch, sans interface graphique.
+// Compilation : g++ -O2 -std=c++17 -pthread batch.cpp -o batch
+//
+// Utilisation : batch [options] <fichier de charge>
+//   --policy NOM                    politique d'ordonnancement : fcfs (défaut), sjf,
+//                                   priority, rr, priority-preemptive, srtf, mlfq, edf
+//   --quantum N                     quantum du tourniquet (4 par défaut) ; pour mlfq,
+//                                   niveaux de quantum N, 2N et 4N
+//   --levels 2,4,8                  mlfq : quantum de chaque niveau, du plus prioritaire
+//   --boost N                       mlfq : période de remontée au niveau 0 (100 ; 0 : jamais)
+//   --cpus N                        nombre de processeurs, chacun avec sa file des prêts (1)
+//   --balance N                     migration périodique vers le moins chargé (0 : jamais)
+//   --no-steal                      un processeur inactif ne prend pas de travail aux autres
+//   --admission                     refuse les processus à échéance qui dépasseraient
+//                                   l'utilisation disponible (garantie sous edf,
+//                                   sur un processeur)
+//   --output FICHIER                résultats par processus (sortie standard par défaut)
+//   --to-binary FICHIER             convertit la charge au format binaire sans simuler
+//                                   (calcul pur seulement)
+//   --edit PID:ARRIVÉE,DURÉE[,PRIO] modifie un processus après la simulation et ne
+//                                   resimule que la fin (répétable)
+//   --gantt FICHIER                 diagramme de Gantt en .png, .svg ou .pdf ; avec --sweep
+//                                   et --replay, dossier d'un diagramme par configuration
+//   --gantt-format png|svg|pdf      format des diagrammes d'un dossier (png par défaut)
+//   --gantt-width N                 largeur en pixels, l'ordonnancement y est réduit
+//   --profile FICHIER               durée des phases et compteurs de l'ordonnanceur en JSON
+//   --chrome-trace FICHIER          les mêmes phases au format Trace Event (chrome://tracing)
+//
+// L'export des diagrammes demande cairo, les relevés une instrumentation compilée :
+//   g++ -O2 -std=c++17 -pthread batch.cpp -o batch `pkg-config --cflags --libs cairo`
+//   g++ -O2 -std=c++17 -pthread -DSCHEDULER_INSTRUMENTATION batch.cpp -o batch
+//
+// Balayage : batch --sweep [options] <charge> [charge...]
+//   --policies a,b,...              politiques évaluées (toutes par défaut)
+//   --quantums 1-64 | 2,4,8         quanta essayés pour rr et mlfq (1-32 par défaut)
+//   --threads N                     threads de calcul (tous les cœurs par défaut)
+//   --objective CRITÈRE             mean-waiting (défaut), p99-waiting, p999-waiting,
+//                                   mean-response, p99-response, p999-response
+//   --cpus, --balance, --no-steal, --levels, --boost, --admission, --output, --gantt,
+//   --profile et --chrome-trace comme ci-dessus
+//
+// Rejeu : batch --replay [options] <trace ftrace ou perf sched script>
+//   --tick N                        nanosecondes par unité de temps (1000 par défaut)
+//   --policies, --quantum, --cpus (par défaut ceux de la trace), --balance, --no-steal,
+//   --threads, --output, --gantt, --profile et --chrome-trace comme ci-dessus
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <sys/stat.h>
+#include <utility>
+#include "process.h"
+#include "simulation.h"
+#include "workload.h"
+#include "sweep.h"
+#include "trace.h"
+#include "instrumentation.h"
+#if __has_include(<cairo.h>)
+#include "gantt.h"
+#endif
+#include "metrics.h"
+#include "histogram.h"
+
+// Écriture tamponnée des résultats, sans flux C++ ni allocation par ligne
+class ResultWriter {
+private:
+    FILE* file;
+    std::vector<char> buffer;
+    size_t used = 0;
+
+    void flush() {
+        std::fwrite(buffer.data(), 1, used, file);
+        used = 0;
+    }
+
+public:
+    explicit ResultWriter(FILE* f) : file(f), buffer(1 << 20) {}
+
+    ~ResultWriter() {
+        flush();
+    }
+
+    void text(const char* s) {
+        size_t length = std::strlen(s);
+        if (used + length > buffer.size())
+            flush();
+        std::memcpy(buffer.data() + used, s, length);
+        used += length;
+    }
+
+    void number(int value, char separator) {
+        if (used + 16 > buffer.size())
+            flush();
+        char* end = std::to_chars(buffer.data() + used, buffer.data() + used + 15, value).ptr;
+        *end++ = separator;
+        used = static_cast<size_t>(end - buffer.data());
+    }
+};
+
+static void usage() {
+    std::string names;
+    for (const PolicyInfo& info : policyRegistry())
+        names += (names.empty() ? "" : "|") + std::string(info.name);
+    std::cerr << "Utilisation : batch [--policy " << names << "] [--quantum N]"
+                 " [--levels 2,4,8] [--boost N] [--cpus N] [--balance N] [--no-steal] [--admission]"
+                 " [--output FICHIER] [--to-binary FICHIER] [--edit PID:ARRIVÉE,DURÉE[,PRIO]] [--gantt FICHIER]"
+                 " [--profile FICHIER] [--chrome-trace FICHIER] <fichier de charge>\n"
+                 "              batch --sweep [--policies a,b] [--quantums 1-64] [--threads N]"
+                 " [--objective CRITÈRE] [--admission] [--output FICHIER] <charge> [charge...]\n"
+                 "              batch --replay [--tick NS] [--policies a,b] [--quantum N] [--cpus N]"
+                 " [--threads N] [--output FICHIER] <trace>\n";
+}
+
+// Moyenne, extrêmes et centiles des métriques, sur la sortie d'erreur
+static void printSummary(const RunMetrics& metrics, const LatencySummary& latency) {
+    auto line = [](const char* label, const ColumnStats& stats, const LatencyHistogram& histogram) {
+        std::cerr << label << " : moyenne " << stats.mean << ", min " << stats.min
+                  << ", max " << stats.max << ", total " << stats.sum
+                  << ", p50 " << histogram.percentile(0.5) << ", p95 " << histogram.percentile(0.95)
+                  << ", p99 " << histogram.percentile(0.99) << ", p99.9 " << histogram.percentile(0.999) << "\n";
+    };
+    line("Attente", metrics.waiting, latency.waiting);
+    line("Rotation", metrics.turnaround, latency.turnaround);
+    line("Réponse", metrics.response, latency.response);
+}
+
+// Utilisation et migrations de chaque processeur, sur la sortie d'erreur ; avec
+// un seul processeur, seulement si les E/S le laissent inactif
+static void printProcessors(const Simulation& simulation, bool io) {
+    const std::vector<ProcessorStats>& stats = simulation.processors();
+    if (stats.size() < 2 && !io)
+        return;
+    int end = std::max(1, simulation.endTime());
+    size_t migrations = 0;
+    for (size_t c = 0; c < stats.size(); ++c) {
+        std::fprintf(stderr, "CPU %zu : utilisation %.1f %%, migrations reçues %zu, cédées %zu\n", c,
+                     100.0 * static_cast<double>(stats[c].busy) / end, stats[c].migratedIn, stats[c].migratedOut);
+        migrations += stats[c].migratedIn;
+    }
+    std::cerr << migrations << " migrations\n";
+}
+
+// Échéances manquées, refus et distribution des retards, sur la sortie d'erreur
+static void printDeadlines(const DeadlineSummary& deadlines) {
+    const LatencyHistogram& tardiness = deadlines.tardiness;
+    std::fprintf(stderr, "Échéances : %llu tenues, %llu manquées (%.2f %%), %llu refusées\n",
+                 static_cast<unsigned long long>(deadlines.count() - deadlines.missed),
+                 static_cast<unsigned long long>(deadlines.missed),
+                 deadlines.count() == 0 ? 0.0 : 100.0 * static_cast<double>(deadlines.missed) / deadlines.count(),
+                 static_cast<unsigned long long>(deadlines.rejected));
+    if (deadlines.count() == 0)
+        return;
+    std::cerr << "Retard : moyenne " << deadlines.meanLateness() << ", min " << deadlines.minLateness
+              << ", max " << deadlines.maxLateness << ", p50 " << tardiness.percentile(0.5)
+              << ", p95 " << tardiness.percentile(0.95) << ", p99 " << tardiness.percentile(0.99)
+              << ", p99.9 " << tardiness.percentile(0.999) << "\n";
+}
+
+// Diagrammes demandés par --gantt
+struct GanttOutput {
+    std::string path;           // Fichier, ou dossier en balayage et en rejeu
+    std::string format = "png"; // Format des fichiers d'un dossier
+    int width = 0;              // 0 : une cellule par unité de temps, dans la limite de cairo
+};
+
+// Diagramme de la simulation principale, lu en place dans ses chronologies
+static void exportChart(const ScheduleView& schedule, const GanttOutput& gantt) {
+#if __has_include(<cairo.h>)
+    GanttChart(schedule, longestIoBurst(*schedule.processes)).exportTo(gantt.path, gantt.width);
+#else
+    (void)schedule;
+    throw std::runtime_error(gantt.path + " : batch compilé sans cairo, pas de diagramme");
+#endif
+}
+
+// Un diagramme par configuration évaluée, simulées de nouveau en parallèle avec
+// leurs chronologies ; `names` distingue les charges quand il y en a plusieurs
+static void exportSweepCharts(const ParameterSweep& sweep, const std::vector<SweepResult>& results,
+                              const std::vector<std::string>& names, const ProcessorConfig& machine,
+                              const GanttOutput& gantt, unsigned threads, Profile* profile) {
+#if __has_include(<cairo.h>)
+    mkdir(gantt.path.c_str(), 0777);
+    std::vector<GanttJob> jobs;
+    for (const auto& r : results) {
+        std::string file = gantt.path + "/";
+        if (names.size() > 1)
+            file += names[r.config.workload] + "-";
+        file += policyInfo(r.config.policy).name;
+        if (policyInfo(r.config.policy).usesQuantum)
+            file += "-q" + std::to_string(r.config.quantum);
+        jobs.push_back({&sweep.workload(r.config.workload), r.config.policy, r.config.quantum, machine,
+                        file + "." + gantt.format, gantt.width, sweep.feedback(), sweep.admissionEnabled()});
+    }
+    auto start = std::chrono::steady_clock::now();
+    exportSchedules(jobs, threads, profile);
+    std::cerr << jobs.size() << " diagrammes dans " << gantt.path << " en "
+              << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s\n";
+#else
+    (void)sweep, (void)results, (void)names, (void)machine, (void)threads, (void)profile;
+    throw std::runtime_error(gantt.path + " : batch compilé sans cairo, pas de diagramme");
+#endif
+}
+
+// Nom d'une charge pour les fichiers de diagrammes : sans dossier ni extension
+static std::string workloadName(const std::string& path) {
+    std::string name = path.substr(path.rfind('/') + 1);
+    return name.substr(0, name.rfind('.'));
+}
+
+// Relevés de l'instrumentation : résumé sur la sortie d'erreur, et fichiers
+// demandés par --profile et --chrome-trace
+static void reportProfile(const Profile& profile, const std::string& json, const std::string& chromeTrace) {
+    if constexpr (!instrumented)
+        return;
+    profile.print(std::cerr);
+    if (!json.empty())
+        profile.writeJson(json);
+    if (!chromeTrace.empty())
+        profile.writeChromeTrace(chromeTrace);
+}
+
+// Nom de la ligne de commande, ou son ancien synonyme "fifo"
+static bool parsePolicy(const std::string& name, Policy& policy) {
+    const PolicyInfo* info = findPolicy(name == "fifo" ? "fcfs" : name);
+    if (info == nullptr)
+        return false;
+    policy = info->policy;
+    return true;
+}
+
+static const char* policyName(Policy policy) {
+    return policyInfo(policy).name;
+}
+
+// "rr quantum 4", ou le seul nom pour les politiques sans quantum
+static std::string configLabel(Policy policy, int quantum) {
+    std::string label = policyName(policy);
+    if (policyInfo(policy).usesQuantum)
+        label += " quantum " + std::to_string(quantum);
+    return label;
+}
+
+static bool parseObjective(const std::string& name, Objective& objective) {
+    if (name == "mean-waiting")
+        objective = Objective::MeanWaiting;
+    else if (name == "p99-waiting")
+        objective = Objective::P99Waiting;
+    else if (name == "p999-waiting")
+        objective = Objective::P999Waiting;
+    else if (name == "mean-response")
+        objective = Objective::MeanResponse;
+    else if (name == "p99-response")
+        objective = Objective::P99Response;
+    else if (name == "p999-response")
+        objective = Objective::P999Response;
+    else
+        return false;
+    return true;
+}
+
+// Liste "a,b,c" de politiques
+static bool parsePolicies(const std::string& list, std::vector<Policy>& policies) {
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t comma = std::min(list.find(',', start), list.size());
+        Policy policy;
+        if (!parsePolicy(list.substr(start, comma - start), policy))
+            return false;
+        policies.push_back(policy);
+        start = comma + 1;
+    }
+    return true;
+}
+
+// Quanta "1-64" (intervalle) ou "2,4,8" (liste)
+static bool parseQuantums(const std::string& spec, std::vector<int>& quantums) {
+    size_t dash = spec.find('-');
+    if (dash != std::string::npos) {
+        int first = std::atoi(spec.c_str());
+        int last = std::atoi(spec.c_str() + dash + 1);
+        if (first <= 0 || last < first)
+            return false;
+        for (int q = first; q <= last; ++q)
+            quantums.push_back(q);
+        return true;
+    }
+    size_t start = 0;
+    while (start <= spec.size()) {
+        size_t comma = std::min(spec.find(',', start), spec.size());
+        int quantum = std::atoi(spec.substr(start, comma - start).c_str());
+        if (quantum <= 0)
+            return false;
+        quantums.push_back(quantum);
+        start = comma + 1;
+    }
+    return true;
+}
+
+// Modification demandée par --edit
+struct ProcessEdit {
+    int pid;
+    int arrival;
+    int burst;
+    int priority; // -1 : inchangée
+};
+
+static bool parseEdit(const std::string& spec, ProcessEdit& edit) {
+    int values[4] = {0, 0, 0, -1};
+    const char* p = spec.data();
+    const char* end = p + spec.size();
+    for (int k = 0; k < 4; ++k) {
+        auto [next, error] = std::from_chars(p, end, values[k]);
+        if (error != std::errc())
+            return false;
+        p = next;
+        if (p == end)
+            break;
+        if (*p != (k == 0 ? ':' : ',') || k == 3)
+            return false;
+        ++p;
+    }
+    if (p != end || values[0] <= 0 || values[1] < 0 || values[2] <= 0)
+        return false;
+    edit = {values[0], values[1], values[2], values[3]};
+    return true;
+}
+
+static ProcessTable loadWorkload(const std::string& path, Profile* profile) {
+    ScopedPhase parsing(profile, "parse");
+    WorkloadReader reader(path);
+    ProcessTable processes;
+    processes.reserve(reader.expectedCount());
+    int pid = 1;
+    reader.read([&](int arrival, const std::vector<int>& bursts, int priority, int deadline, int period) {
+        processes.addBursts(pid++, arrival, bursts, priority);
+        if (deadline >= 0)
+            processes.setDeadline(processes.size() - 1, deadline, period);
+    });
+    return processes;
+}
+
+// Termine l'écriture des résultats : ferme le fichier, ou vide la sortie
+// standard ; false si une écriture a échoué
+static bool closeOutput(FILE* file) {
+    bool ok = std::ferror(file) == 0;
+    if (file != stdout)
+        ok = std::fclose(file) == 0 && ok;
+    else
+        ok = std::fflush(file) == 0 && ok;
+    if (!ok)
+        std::cerr << "Erreur d'écriture des résultats\n";
+    return ok;
+}
+
+// Évalue toutes les combinaisons et affiche les meilleures configurations
+static int runSweep(const std::vector<std::string>& inputs, std::vector<Policy> policies,
+                    std::vector<int> quantums, const ProcessorConfig& machine, const FeedbackConfig& feedback,
+                    bool admission, unsigned threads, Objective objective, const std::string& output,
+                    const GanttOutput& gantt, Profile* profile) {
+    if (policies.empty())
+        for (const PolicyInfo& info : policyRegistry())
+            policies.push_back(info.policy);
+    if (quantums.empty())
+        parseQuantums("1-32", quantums);
+
+    ParameterSweep sweep;
+    sweep.configureProcessors(machine);
+    sweep.configureFeedback(feedback);
+    sweep.enableAdmission(admission);
+    sweep.instrument(profile);
+    for (const auto& input : inputs)
+        sweep.addWorkload(loadWorkload(input, profile));
+    sweep.addAll(policies, quantums);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SweepResult> results = sweep.run(threads);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    FILE* file = output.empty() ? stdout : std::fopen(output.c_str(), "w");
+    if (file == nullptr) {
+        std::cerr << output << " : impossible de créer le fichier\n";
+        return 1;
+    }
+    std::fprintf(file, "workload,policy,quantum,mean_waiting,p99_waiting,mean_response,p99_response,mean_turnaround,"
+                       "p50_waiting,p95_waiting,p999_waiting,p50_response,p95_response,p999_response\n");
+    for (const auto& r : results) {
+        const LatencyHistogram& waiting = r.latency.waiting;
+        const LatencyHistogram& response = r.latency.response;
+        std::fprintf(file, "%s,%s,%d,%.3f,%d,%.3f,%d,%.3f,%d,%d,%d,%d,%d,%d\n", inputs[r.config.workload].c_str(),
+                     policyName(r.config.policy), r.config.quantum, waiting.mean(), waiting.percentile(0.99),
+                     response.mean(), response.percentile(0.99), r.latency.turnaround.mean(),
+                     waiting.percentile(0.5), waiting.percentile(0.95), waiting.percentile(0.999),
+                     response.percentile(0.5), response.percentile(0.95), response.percentile(0.999));
+    }
+    if (!closeOutput(file))
+        return 1;
+
+    std::cerr << results.size() << " configurations évaluées en " << elapsed << " s\n";
+    for (size_t w = 0; w < inputs.size(); ++w) {
+        const SweepResult* best = ParameterSweep::best(results, objective, w);
+        if (best != nullptr)
+            std::cerr << inputs[w] << " : meilleure configuration " << configLabel(best->config.policy, best->config.quantum)
+                      << " (" << objectiveValue(*best, objective) << ")\n";
+    }
+
+    // Sur plusieurs charges, les histogrammes d'une même configuration sont
+    // additionnés : le critère porte sur l'ensemble de leurs processus
+    if (inputs.size() > 1) {
+        ScopedPhase aggregating(profile, "aggregate");
+        std::map<std::pair<int, int>, LatencySummary> merged;
+        for (const auto& r : results)
+            merged[{static_cast<int>(r.config.policy), r.config.quantum}].merge(r.latency);
+        auto best = std::min_element(merged.begin(), merged.end(), [objective](const auto& a, const auto& b) {
+            return objectiveValue(a.second, objective) < objectiveValue(b.second, objective);
+        });
+        std::cerr << "Toutes charges : " << configLabel(static_cast<Policy>(best->first.first), best->first.second)
+                  << " (" << objectiveValue(best->second, objective) << ")\n";
+    }
+
+    if (!gantt.path.empty()) {
+        std::vector<std::string> names;
+        for (const auto& input : inputs)
+            names.push_back(workloadName(input));
+        exportSweepCharts(sweep, results, names, machine, gantt, threads, profile);
+    }
+    return 0;
+}
+
+// Rejoue une trace de l'ordonnanceur Linux sous chaque politique et compare
+// au comportement du noyau : une ligne CSV par source, le noyau en premier
+static int runReplay(const std::string& input, std::vector<Policy> policies, int quantum, ProcessorConfig machine,
+                     const FeedbackConfig& feedback, bool cpusGiven, long long tick, unsigned threads, const std::string& output,
+                     const GanttOutput& gantt, Profile* profile) {
+    if (policies.empty())
+        for (const PolicyInfo& info : policyRegistry())
+            policies.push_back(info.policy);
+
+    auto start = std::chrono::steady_clock::now();
+    TraceWorkload trace;
+    {
+        ScopedPhase reading(profile, "parse");
+        trace = TraceReader(input, tick).read();
+    }
+    double parsing = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (trace.events == 0) {
+        std::cerr << input << " : aucun événement sched_switch ou sched_wakeup\n";
+        return 1;
+    }
+    if (!cpusGiven)
+        machine.cpus = trace.cpus;
+
+    ParameterSweep sweep;
+    sweep.configureProcessors(machine);
+    sweep.configureFeedback(feedback);
+    sweep.instrument(profile);
+    sweep.addWorkload(std::move(trace.processes));
+    sweep.addAll(policies, {quantum});
+    start = std::chrono::steady_clock::now();
+    std::vector<SweepResult> results = sweep.run(threads);
+    double simulating = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    FILE* file = output.empty() ? stdout : std::fopen(output.c_str(), "w");
+    if (file == nullptr) {
+        std::cerr << output << " : impossible de créer le fichier\n";
+        return 1;
+    }
+    std::fprintf(file, "source,quantum,mean_waiting,p50_waiting,p99_waiting,mean_turnaround,p50_turnaround,"
+                       "p99_turnaround,mean_response,p50_response,p99_response\n");
+    auto row = [file](const char* source, int rowQuantum, const LatencySummary& latency) {
+        std::fprintf(file, "%s,%d", source, rowQuantum);
+        for (const LatencyHistogram* h : {&latency.waiting, &latency.turnaround, &latency.response})
+            std::fprintf(file, ",%.3f,%d,%d", h->mean(), h->percentile(0.5), h->percentile(0.99));
+        std::fprintf(file, "\n");
+    };
+    row("kernel", 0, trace.kernel);
+    for (const auto& r : results)
+        row(policyName(r.config.policy), r.config.quantum, r.latency);
+    if (!closeOutput(file))
+        return 1;
+
+    double megabytes = static_cast<double>(trace.bytes) / (1 << 20);
+    std::cerr << trace.events << " événements, " << trace.tid.size() << " tâches, " << trace.cpus
+              << " processeurs ; lecture " << parsing << " s (" << megabytes / std::max(parsing, 1e-9)
+              << " Mio/s), " << results.size() << " politiques simulées en " << simulating << " s\n";
+
+    // Politique la plus proche du noyau, sur l'attente moyenne
+    const LatencyHistogram& kernel = trace.kernel.waiting;
+    const SweepResult* closest = nullptr;
+    for (const auto& r : results)
+        if (closest == nullptr || std::abs(r.latency.waiting.mean() - kernel.mean()) <
+                                      std::abs(closest->latency.waiting.mean() - kernel.mean()))
+            closest = &r;
+    if (closest != nullptr)
+        std::cerr << "Attente moyenne du noyau " << kernel.mean() << ", la plus proche : "
+                  << configLabel(closest->config.policy, closest->config.quantum) << " ("
+                  << closest->latency.waiting.mean() << ")\n";
+
+    if (!gantt.path.empty())
+        exportSweepCharts(sweep, results, {}, machine, gantt, threads, profile);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    Policy policy = Policy::FCFS;
+    int quantum = 4;
+    std::string input, output, binaryOutput;
+    bool sweepMode = false;
+    bool replayMode = false;
+    bool cpusGiven = false;
+    long long tick = 1000;
+    std::vector<std::string> inputs;
+    std::vector<Policy> sweepPolicies;
+    std::vector<int> sweepQuantums;
+    unsigned threads = 0;
+    Objective objective = Objective::MeanWaiting;
+    std::vector<ProcessEdit> edits;
+    FeedbackConfig feedback;
+    ProcessorConfig machine;
+    GanttOutput gantt;
+    bool admission = false;
+    Profile profile;
+    std::string profileOutput;
+    std::string chromeTrace;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--policy" && hasValue) {
+            if (!parsePolicy(argv[++i], policy)) {
+                std::cerr << "Politique inconnue : " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--quantum" && hasValue) {
+            quantum = std::atoi(argv[++i]);
+            if (quantum <= 0) {
+                std::cerr << "Le quantum doit être strictement positif\n";
+                return 1;
+            }
+        } else if (arg == "--levels" && hasValue) {
+            if (!parseQuantums(argv[++i], feedback.quanta)) {
+                std::cerr << "Quanta de niveaux invalides : " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--boost" && hasValue) {
+            feedback.boostPeriod = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--cpus" && hasValue) {
+            machine.cpus = std::atoi(argv[++i]);
+            cpusGiven = true;
+            if (machine.cpus <= 0) {
+                std::cerr << "Le nombre de processeurs doit être strictement positif\n";
+                return 1;
+            }
+        } else if (arg == "--balance" && hasValue) {
+            machine.balancePeriod = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--no-steal") {
+            machine.stealOnIdle = false;
+        } else if (arg == "--admission") {
+            admission = true;
+        } else if (arg == "--output" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--to-binary" && hasValue) {
+            binaryOutput = argv[++i];
+        } else if (arg == "--edit" && hasValue) {
+            ProcessEdit edit;
+            if (!parseEdit(argv[++i], edit)) {
+                std::cerr << "Modification invalide : " << argv[i] << "\n";
+                return 1;
+            }
+            edits.push_back(edit);
+        } else if (arg == "--gantt" && hasValue) {
+            gantt.path = argv[++i];
+        } else if (arg == "--gantt-format" && hasValue) {
+            gantt.format = argv[++i];
+            if (gantt.format != "png" && gantt.format != "svg" && gantt.format != "pdf") {
+                std::cerr << "Format de diagramme inconnu : " << gantt.format << "\n";
+                return 1;
+            }
+        } else if (arg == "--gantt-width" && hasValue) {
+            gantt.width = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--profile" && hasValue) {
+            profileOutput = argv[++i];
+        } else if (arg == "--chrome-trace" && hasValue) {
+            chromeTrace = argv[++i];
+        } else if (arg == "--sweep") {
+            sweepMode = true;
+        } else if (arg == "--replay") {
+            replayMode = true;
+        } else if (arg == "--tick" && hasValue) {
+            tick = std::atoll(argv[++i]);
+            if (tick <= 0) {
+                std::cerr << "L'unité de temps doit être strictement positive\n";
+                return 1;
+            }
+        } else if (arg == "--policies" && hasValue) {
+            if (!parsePolicies(argv[++i], sweepPolicies)) {
+                std::cerr << "Liste de politiques invalide : " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--quantums" && hasValue) {
+            if (!parseQuantums(argv[++i], sweepQuantums)) {
+                std::cerr << "Quanta invalides : " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (arg == "--threads" && hasValue) {
+            threads = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--objective" && hasValue) {
+            if (!parseObjective(argv[++i], objective)) {
+                std::cerr << "Critère inconnu : " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (!arg.empty() && arg[0] != '-') {
+            inputs.push_back(arg);
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (inputs.empty() || (!sweepMode && inputs.size() > 1)) {
+        usage();
+        return 1;
+    }
+    input = inputs.front();
+#if !__has_include(<cairo.h>)
+    if (!gantt.path.empty()) {
+        std::cerr << "--gantt : batch compilé sans cairo (voir l'en-tête de batch.cpp)\n";
+        return 1;
+    }
+#endif
+    if (!instrumented && (!profileOutput.empty() || !chromeTrace.empty())) {
+        std::cerr << "--profile, --chrome-trace : batch compilé sans -DSCHEDULER_INSTRUMENTATION\n";
+        return 1;
+    }
+    if (admission && replayMode) {
+        std::cerr << "--admission : une trace n'a pas d'échéances\n";
+        return 1;
+    }
+    // Le test n'assure les échéances des admis que sous EDF, sur un processeur
+    if (admission) {
+        bool edfOnly = sweepMode ? !sweepPolicies.empty() && std::all_of(sweepPolicies.begin(), sweepPolicies.end(),
+                                                                          [](Policy p) { return p == Policy::EDF; })
+                                 : policy == Policy::EDF;
+        if (!edfOnly || machine.cpus > 1)
+            std::cerr << "--admission : sans garantie d'échéance hors de edf sur un processeur\n";
+    }
+
+    try {
+        if (sweepMode || replayMode) {
+            int status = sweepMode
+                ? runSweep(inputs, sweepPolicies, sweepQuantums, machine, feedback, admission, threads, objective,
+                           output, gantt, &profile)
+                : runReplay(input, sweepPolicies, quantum, machine, feedback, cpusGiven, tick, threads, output, gantt,
+                            &profile);
+            if (status == 0)
+                reportProfile(profile, profileOutput, chromeTrace);
+            return status;
+        }
+
+        WorkloadReader reader(input);
+
+        if (!binaryOutput.empty()) {
+            WorkloadWriter writer(binaryOutput);
+            size_t count = reader.read([&](int arrival, int burst, int priority) {
+                writer.add(arrival, burst, priority);
+            });
+            writer.finish();
+            std::cerr << count << " processus convertis\n";
+            return 0;
+        }
+
+        // Les noms ("Processus N") ne sont construits qu'à l'écriture des résultats
+        ProcessTable processes;
+        processes.reserve(reader.expectedCount());
+        int pid = 1;
+        auto start = std::chrono::steady_clock::now();
+        {
+            ScopedPhase parsing(&profile, "parse");
+            reader.read([&](int arrival, const std::vector<int>& bursts, int priority, int deadline, int period) {
+                processes.addBursts(pid++, arrival, bursts, priority);
+                if (deadline >= 0)
+                    processes.setDeadline(processes.size() - 1, deadline, period);
+            });
+        }
+        auto parsed = std::chrono::steady_clock::now();
+
+        // Chronologies seulement si un diagramme est demandé
+        Timeline timeline, blocked;
+        std::vector<std::unique_ptr<Timeline>> lanes;
+        std::vector<Timeline*> cpuLanes;
+        bool charting = !gantt.path.empty();
+        if (charting && machine.cpus > 1) {
+            for (int c = 0; c < machine.cpus; ++c) {
+                lanes.push_back(std::make_unique<Timeline>());
+                cpuLanes.push_back(lanes.back().get());
+            }
+        }
+        Simulation simulation(processes, charting ? &timeline : nullptr, nullptr, &profile);
+        if (charting)
+            simulation.recordBlocked(&blocked);
+        simulation.configureFeedback(feedback);
+        simulation.configureProcessors(machine, cpuLanes);
+        simulation.enableCheckpoints(!edits.empty());
+        simulation.enableAdmission(admission);
+        simulation.run(policy, quantum);
+        auto simulated = std::chrono::steady_clock::now();
+
+        // Analyse « et si » : les processus modifiés sont mis à jour dans la
+        // table, puis seule la fin de la simulation est refaite
+        if (!edits.empty()) {
+            printSummary(aggregateMetrics(processes), simulation.latencies());
+            std::vector<std::uint32_t> edited;
+            std::vector<int> oldArrivals;
+            for (const ProcessEdit& edit : edits) {
+                size_t i = static_cast<size_t>(edit.pid - 1);
+                if (i >= processes.size() || processes.pid[i] != edit.pid)
+                    throw std::runtime_error("pid inconnu : " + std::to_string(edit.pid));
+                if (processes.burstCount(i) > 1)
+                    throw std::runtime_error("--edit : le processus " + std::to_string(edit.pid) + " fait des E/S");
+                if (std::find(edited.begin(), edited.end(), i) == edited.end()) {
+                    edited.push_back(static_cast<std::uint32_t>(i));
+                    oldArrivals.push_back(processes.arrivalTime[i]);
+                }
+                processes.arrivalTime[i] = edit.arrival;
+                processes.burstTime[i] = edit.burst;
+                if (edit.priority >= 0)
+                    processes.priority[i] = edit.priority;
+            }
+            bool resumed = simulation.rewind(edited, oldArrivals);
+            if (resumed)
+                simulation.resume();
+            else
+                simulation.run(policy, quantum);
+            auto resimulated = std::chrono::steady_clock::now();
+            std::cerr << "Après modification : resimulation "
+                      << (resumed ? "depuis un point de reprise" : "complète") << " en "
+                      << std::chrono::duration<double>(resimulated - simulated).count() << " s\n";
+        }
+
+        FILE* file = output.empty() ? stdout : std::fopen(output.c_str(), "w");
+        if (file == nullptr) {
+            std::cerr << output << " : impossible de créer le fichier\n";
+            return 1;
+        }
+        {
+            ScopedPhase writing(&profile, "write");
+            ResultWriter writer(file);
+            // Colonne io seulement si des processus font des E/S, deadline et
+            // lateness s'ils ont des échéances (vides pour les autres, retard
+            // vide pour un refusé)
+            bool io = processes.hasIo();
+            bool deadlines = processes.hasDeadlines();
+            writer.text("pid,name,arrival,burst,priority,waiting,turnaround,response");
+            writer.text(io ? ",io" : "");
+            writer.text(deadlines ? ",deadline,lateness\n" : "\n");
+            for (size_t i = 0; i < processes.size(); ++i) {
+                writer.number(processes.pid[i], ',');
+                writer.text("Processus ");
+                writer.number(processes.pid[i], ',');
+                writer.number(processes.arrivalTime[i], ',');
+                writer.number(processes.burstTime[i], ',');
+                writer.number(processes.priority[i], ',');
+                writer.number(processes.waitingTime[i], ',');
+                writer.number(processes.turnaroundTime[i], ',');
+                writer.number(processes.responseTime[i], io || deadlines ? ',' : '\n');
+                if (io)
+                    writer.number(processes.ioTime[i], deadlines ? ',' : '\n');
+                if (!deadlines)
+                    continue;
+                if (!processes.hasDeadline(i)) {
+                    writer.text(",\n");
+                    continue;
+                }
+                writer.number(processes.deadline[i], ',');
+                if (processes.turnaroundTime[i] >= 0)
+                    writer.number(processes.turnaroundTime[i] - processes.deadline[i], '\n');
+                else
+                    writer.text("\n");
+            }
+        }
+        if (!closeOutput(file))
+            return 1;
+
+        auto seconds = [](auto a, auto b) { return std::chrono::duration<double>(b - a).count(); };
+        std::cerr << processes.size() << " processus, lecture " << seconds(start, parsed)
+                  << " s, simulation " << seconds(parsed, simulated) << " s\n";
+        RunMetrics metrics;
+        {
+            ScopedPhase aggregating(&profile, "aggregate");
+            // Les refusés ne comptent pas : agrégats tirés des histogrammes
+            metrics = simulation.deadlines().rejected > 0 ? summaryMetrics(simulation.latencies())
+                                                          : aggregateMetrics(processes);
+        }
+        printSummary(metrics, simulation.latencies());
+        if (processes.hasIo())
+            std::cerr << "E/S : total " << columnStats(processes.ioTime.data(), processes.size()).sum << "\n";
+        if (processes.hasDeadlines())
+            printDeadlines(simulation.deadlines());
+        printProcessors(simulation, processes.hasIo());
+        if (charting) {
+            ScopedPhase rendering(&profile, "render");
+            exportChart(simulation.schedule(), gantt);
+        }
+        reportProfile(profile, profileOutput, chromeTrace);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
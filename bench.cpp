@@ -0,0 +1,147 @@
+// Banc d'essai des politiques d'ordonnancement sur des charges synthétiques.
+// Compilation : g++ -O2 -std=c++17 bench.cpp -o bench
+//
+// Utilisation : bench [options]
+//   --min N        plus petite taille (1000 par défaut)
+//   --max N        plus grande taille (10000000 par défaut), tailles en puissances de 10
+//   --seed S       graine des générateurs (42 par défaut)
+//   --repeat R     répétitions par mesure, on garde la meilleure (1 par défaut)
+//   --workload W   limite à un scénario (poisson, pareto, rafales, priorites)
+//   --cpus N       simule N processeurs avec vol de travail (1 par défaut)
+//   --csv FICHIER  écrit aussi les mesures en CSV pour tracer les courbes
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "process.h"
+#include "simulation.h"
+#include "generators.h"
+
+// Lit une valeur en Kio dans /proc/self/status (VmRSS, VmHWM)
+static long readStatusKb(const char* field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    size_t length = std::strlen(field);
+    while (std::getline(status, line)) {
+        if (line.compare(0, length, field) == 0 && line[length] == ':')
+            return std::atol(line.c_str() + length + 1);
+    }
+    return 0;
+}
+
+// Remet le pic de mémoire résidente (VmHWM) au niveau actuel
+static void resetPeakMemory() {
+    FILE* file = std::fopen("/proc/self/clear_refs", "w");
+    if (file != nullptr) {
+        std::fputs("5", file);
+        std::fclose(file);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t minSize = 1000;
+    size_t maxSize = 10000000;
+    std::uint64_t seed = 42;
+    int repeat = 1;
+    ProcessorConfig machine;
+    std::string only, csvPath;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--min")
+            minSize = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (arg == "--max")
+            maxSize = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (arg == "--seed")
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (arg == "--repeat")
+            repeat = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--cpus")
+            machine.cpus = std::max(1, std::atoi(argv[i + 1]));
+        else if (arg == "--workload")
+            only = argv[i + 1];
+        else if (arg == "--csv")
+            csvPath = argv[i + 1];
+        else {
+            std::cerr << "Option inconnue : " << arg << "\n";
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Option sans valeur : " << argv[argc - 1] << "\n";
+        return 1;
+    }
+
+    std::ofstream csv;
+    if (!csvPath.empty()) {
+        csv.open(csvPath);
+        csv << "workload,policy,processes,seconds,processes_per_second,peak_rss_kb,slope\n";
+    }
+
+    std::cout << std::left << std::setw(10) << "charge" << std::setw(21) << "politique"
+              << std::right << std::setw(10) << "processus" << std::setw(12) << "temps (s)"
+              << std::setw(14) << "proc/s" << std::setw(12) << "pic (Mio)"
+              << std::setw(8) << "pente" << "\n";
+
+    const std::vector<PolicyInfo>& policies = policyRegistry();
+    for (const auto& spec : standardWorkloads()) {
+        if (!only.empty() && spec.name != only)
+            continue;
+
+        std::vector<double> previous(policies.size(), 0.0);
+        for (size_t n = minSize; n <= maxSize; n *= 10) {
+            // La charge est générée une fois par taille, chaque mesure en travaille une copie
+            ProcessTable workload;
+            workload.reserve(n);
+            int pid = 1;
+            WorkloadGenerator(spec, seed + n).generate(n, [&](int arrival, int burst, int priority) {
+                workload.add(pid++, arrival, burst, priority);
+            });
+
+            for (size_t k = 0; k < policies.size(); ++k) {
+                double best = 0.0;
+                long peak = 0;
+                for (int r = 0; r < repeat; ++r) {
+                    ProcessTable processes = workload;
+                    resetPeakMemory();
+                    auto start = std::chrono::steady_clock::now();
+                    Simulation simulation(processes);
+                    simulation.configureProcessors(machine);
+                    simulation.run(policies[k].policy);
+                    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    peak = std::max(peak, readStatusKb("VmHWM"));
+                    if (r == 0 || elapsed < best)
+                        best = elapsed;
+                }
+
+                // Pente log-log par rapport à la taille précédente : 1 = linéaire
+                double slope = previous[k] > 0.0 ? std::log10(best / previous[k]) : 0.0;
+                previous[k] = best;
+                double rate = best > 0.0 ? n / best : 0.0;
+
+                std::cout << std::left << std::setw(10) << spec.name << std::setw(21) << policies[k].name
+                          << std::right << std::setw(10) << n
+                          << std::setw(12) << std::fixed << std::setprecision(4) << best
+                          << std::setw(14) << std::setprecision(0) << rate
+                          << std::setw(12) << std::setprecision(1) << peak / 1024.0
+                          << std::setw(8) << std::setprecision(2);
+                if (n == minSize)
+                    std::cout << "-";
+                else
+                    std::cout << slope;
+                std::cout << "\n";
+
+                if (csv.is_open())
+                    csv << spec.name << ',' << policies[k].name << ',' << n << ',' << best << ','
+                        << rate << ',' << peak << ',' << (n == minSize ? 0.0 : slope) << '\n';
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,571 @@
+// Vérifications du moteur de simulation sur des charges aléatoires : chaque
+// politique est comparée à une simulation de référence qui avance d'une unité
+// de temps à la fois, sans aucune des optimisations du moteur (sur un ou deux
+// processeurs), la boucle multiprocesseur à celle d'un processeur, la reprise
+// après modification à une simulation complète, le contrôle d'admission à un
+// calcul direct ; s'y ajoutent des invariants (rotation avec E/S, MLFQ à un
+// niveau, centiles, réutilisation de la mémoire).
+// Avec les vérifications de mémoire :
+//   g++ -O1 -g -fsanitize=address,undefined -std=c++17 -pthread check.cpp -o check
+// Compilation : g++ -O2 -std=c++17 -pthread check.cpp -o check
+//
+// Utilisation : check [options]
+//   --seed S       graine des charges (1 par défaut)
+//   --rounds N     charges aléatoires par vérification (2000 par défaut)
+//
+// Une ligne par vérification ; code de sortie 1 si l'une échoue.
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <tuple>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <climits>
+#include "process.h"
+#include "simulation.h"
+
+static int failures = 0;
+
+// Affiche le bilan d'une vérification : `errors` cas faux sur `cases`
+static void report(const std::string& name, size_t errors, size_t cases) {
+    std::cout << (errors == 0 ? "ok      " : "ÉCHEC   ") << name << " (" << cases << " cas";
+    if (errors != 0)
+        std::cout << ", " << errors << " faux";
+    std::cout << ")\n";
+    if (errors != 0)
+        failures++;
+}
+
+// Charge de calcul pur : n processus, arrivées et durées tirées au hasard,
+// avec des égalités fréquentes pour éprouver les règles de départage
+static ProcessTable randomWorkload(std::mt19937& rng, int n, int maxArrival, int maxBurst) {
+    ProcessTable table;
+    for (int i = 0; i < n; ++i)
+        table.add(i + 1, static_cast<int>(rng() % (maxArrival + 1)), 1 + static_cast<int>(rng() % maxBurst),
+                  static_cast<int>(rng() % 4));
+    return table;
+}
+
+// Comme randomWorkload, mais un processus sur trois alterne calcul et E/S
+static ProcessTable randomIoWorkload(std::mt19937& rng, int n, int maxArrival, int maxBurst) {
+    ProcessTable table;
+    std::vector<int> bursts;
+    for (int i = 0; i < n; ++i) {
+        bursts.assign(1, 1 + static_cast<int>(rng() % maxBurst));
+        if (rng() % 3 == 0) {
+            for (int k = static_cast<int>(rng() % 3); k >= 0; --k) {
+                bursts.push_back(1 + static_cast<int>(rng() % maxBurst));
+                bursts.push_back(1 + static_cast<int>(rng() % maxBurst));
+            }
+        }
+        table.addBursts(i + 1, static_cast<int>(rng() % (maxArrival + 1)), bursts, static_cast<int>(rng() % 4));
+    }
+    return table;
+}
+
+// Échéances aléatoires sur environ deux processus sur trois
+static void addDeadlines(std::mt19937& rng, ProcessTable& table) {
+    for (size_t i = 0; i < table.size(); ++i)
+        if (rng() % 3 != 0)
+            table.setDeadline(i, table.burstTime[i] + static_cast<int>(rng() % 20));
+}
+
+// Simulation de référence sur un processeur, une unité de temps par tour de
+// boucle. Les arrivées d'un instant entrent en file avant le processus dont la
+// tranche du tourniquet se termine au même instant.
+static void referenceRun(ProcessTable& p, Policy policy, int quantum) {
+    const int n = static_cast<int>(p.size());
+    std::vector<int> remaining(p.burstTime), response(n, -1);
+    std::vector<bool> arrived(n, false);
+    std::vector<int> ready;    // Politiques à clé
+    std::deque<int> fifo;      // Tourniquet
+    int time = 0, done = 0, current = -1, slice = 0;
+
+    auto admit = [&]() {
+        for (int i = 0; i < n; ++i) {
+            if (!arrived[i] && p.arrivalTime[i] <= time) {
+                arrived[i] = true;
+                if (policy == Policy::RoundRobin)
+                    fifo.push_back(i);
+                else
+                    ready.push_back(i);
+            }
+        }
+    };
+    auto key = [&](int i) -> std::tuple<long long, long long, int> {
+        switch (policy) {
+        case Policy::SJF:
+        case Policy::SRTF:
+            return {remaining[i], p.arrivalTime[i], i};
+        case Policy::Priority:
+        case Policy::PriorityPreemptive:
+            return {p.priority[i], p.arrivalTime[i], i};
+        case Policy::EDF:
+            return {p.dueTime(i), p.arrivalTime[i], i};
+        default:
+            return {p.arrivalTime[i], 0, i};
+        }
+    };
+    bool preemptive = policy == Policy::PriorityPreemptive || policy == Policy::SRTF || policy == Policy::EDF;
+
+    while (done < n) {
+        admit();
+        if (policy == Policy::RoundRobin) {
+            if (current < 0) {
+                if (fifo.empty()) {
+                    time++;
+                    continue;
+                }
+                current = fifo.front();
+                fifo.pop_front();
+                slice = 0;
+            }
+        } else {
+            if (current >= 0 && preemptive) {
+                ready.push_back(current);
+                current = -1;
+            }
+            if (current < 0) {
+                if (ready.empty()) {
+                    time++;
+                    continue;
+                }
+                size_t best = 0;
+                for (size_t k = 1; k < ready.size(); ++k)
+                    if (key(ready[k]) < key(ready[best]))
+                        best = k;
+                current = ready[best];
+                ready.erase(ready.begin() + static_cast<long>(best));
+            }
+        }
+        if (response[current] < 0)
+            response[current] = time - p.arrivalTime[current];
+        time++;
+        slice++;
+        if (--remaining[current] == 0) {
+            p.turnaroundTime[current] = time - p.arrivalTime[current];
+            p.waitingTime[current] = p.turnaroundTime[current] - p.burstTime[current];
+            p.responseTime[current] = response[current];
+            done++;
+            current = -1;
+        } else if (policy == Policy::RoundRobin && slice == quantum) {
+            admit();
+            fifo.push_back(current);
+            current = -1;
+        }
+    }
+}
+
+// Mêmes temps d'attente, de rotation et de réponse pour tous les processus
+static bool sameResults(const ProcessTable& a, const ProcessTable& b) {
+    return a.waitingTime == b.waitingTime && a.turnaroundTime == b.turnaroundTime &&
+           a.responseTime == b.responseTime;
+}
+
+// La boucle à événements de chaque politique donne les résultats de la référence
+static void checkAgainstReference(std::mt19937& rng, int rounds) {
+    for (const PolicyInfo& info : policyRegistry()) {
+        if (info.policy == Policy::MLFQ)
+            continue; // Vérifiée par comparaison au tourniquet
+        size_t errors = 0;
+        for (int r = 0; r < rounds; ++r) {
+            ProcessTable workload = randomWorkload(rng, 1 + static_cast<int>(rng() % 12), 30, 9);
+            if (info.policy == Policy::EDF)
+                addDeadlines(rng, workload);
+            int quantum = 1 + static_cast<int>(rng() % 4);
+            ProcessTable expected = workload, actual = workload;
+            referenceRun(expected, info.policy, quantum);
+            Simulation(actual).run(info.policy, quantum);
+            errors += !sameResults(expected, actual);
+        }
+        report(std::string("référence tick par tick : ") + info.name, errors, rounds);
+    }
+}
+
+// Référence sur `cpus` processeurs sans migration (ni vol ni équilibrage),
+// une unité de temps par tour. À chaque date, les arrivées vont d'abord au
+// processeur le moins chargé (en attente et en cours, à égalité le plus petit
+// numéro), un processus qui se termine à cette date comptant encore ; puis
+// chaque processeur termine ou remet en file son processus et en choisit un.
+static void referenceProcessors(ProcessTable& p, Policy policy, int quantum, int cpus) {
+    const int n = static_cast<int>(p.size());
+    struct Cpu {
+        std::vector<int> ready;
+        std::deque<int> fifo;
+        int current = -1, slice = 0;
+    };
+    std::vector<Cpu> cpu(cpus);
+    std::vector<int> remaining(p.burstTime), response(n, -1);
+    std::vector<bool> arrived(n, false);
+    int time = 0, done = 0;
+    bool preemptive = policy == Policy::PriorityPreemptive || policy == Policy::SRTF || policy == Policy::EDF;
+    auto key = [&](int i) -> std::tuple<long long, long long, int> {
+        switch (policy) {
+        case Policy::SJF:
+        case Policy::SRTF:
+            return {remaining[i], p.arrivalTime[i], i};
+        case Policy::Priority:
+        case Policy::PriorityPreemptive:
+            return {p.priority[i], p.arrivalTime[i], i};
+        case Policy::EDF:
+            return {p.dueTime(i), p.arrivalTime[i], i};
+        default:
+            return {p.arrivalTime[i], 0, i};
+        }
+    };
+
+    while (done < n) {
+        for (int i = 0; i < n; ++i) {
+            if (arrived[i] || p.arrivalTime[i] > time)
+                continue;
+            arrived[i] = true;
+            size_t best = 0, bestLoad = SIZE_MAX;
+            for (int c = 0; c < cpus; ++c) {
+                size_t load = cpu[c].ready.size() + cpu[c].fifo.size() + (cpu[c].current >= 0);
+                if (load < bestLoad) {
+                    best = static_cast<size_t>(c);
+                    bestLoad = load;
+                }
+            }
+            (policy == Policy::RoundRobin ? cpu[best].fifo.push_back(i) : cpu[best].ready.push_back(i));
+        }
+        for (Cpu& c : cpu) {
+            if (c.current >= 0) {
+                if (remaining[c.current] == 0) {
+                    p.turnaroundTime[c.current] = time - p.arrivalTime[c.current];
+                    p.waitingTime[c.current] = p.turnaroundTime[c.current] - p.burstTime[c.current];
+                    p.responseTime[c.current] = response[c.current];
+                    done++;
+                    c.current = -1;
+                } else if (policy == Policy::RoundRobin && c.slice == quantum) {
+                    c.fifo.push_back(c.current);
+                    c.current = -1;
+                } else if (preemptive) {
+                    c.ready.push_back(c.current);
+                    c.current = -1;
+                }
+            }
+            if (c.current < 0 && policy == Policy::RoundRobin && !c.fifo.empty()) {
+                c.current = c.fifo.front();
+                c.fifo.pop_front();
+                c.slice = 0;
+            } else if (c.current < 0 && !c.ready.empty()) {
+                size_t best = 0;
+                for (size_t k = 1; k < c.ready.size(); ++k)
+                    if (key(c.ready[k]) < key(c.ready[best]))
+                        best = k;
+                c.current = c.ready[best];
+                c.ready.erase(c.ready.begin() + static_cast<long>(best));
+            }
+            if (c.current >= 0) {
+                if (response[c.current] < 0)
+                    response[c.current] = time - p.arrivalTime[c.current];
+                remaining[c.current]--;
+                c.slice++;
+            }
+        }
+        time++;
+    }
+}
+
+// La boucle multiprocesseur sur un seul processeur donne les résultats de la
+// boucle dédiée, avec E/S et pour toutes les politiques ; sur deux
+// processeurs sans migration, ceux de la référence
+static void checkProcessorLoops(std::mt19937& rng, int rounds) {
+    for (const PolicyInfo& info : policyRegistry()) {
+        size_t errors = 0;
+        for (int r = 0; r < rounds / 4; ++r) {
+            ProcessTable workload = r % 2 == 0 ? randomWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9)
+                                               : randomIoWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9);
+            if (info.policy == Policy::EDF)
+                addDeadlines(rng, workload);
+            int quantum = 1 + static_cast<int>(rng() % 4);
+            ProcessorConfig machine;
+            machine.forceProcessorLoop = true;
+            ProcessTable expected = workload;
+            Simulation(expected).run(info.policy, quantum);
+            Simulation simulation(workload);
+            simulation.configureProcessors(machine);
+            simulation.run(info.policy, quantum);
+            errors += !sameResults(expected, workload);
+        }
+        report(std::string("boucle multiprocesseur sur un processeur : ") + info.name, errors, rounds / 4);
+    }
+    for (const PolicyInfo& info : policyRegistry()) {
+        if (info.policy == Policy::MLFQ)
+            continue;
+        size_t errors = 0;
+        for (int r = 0; r < rounds / 4; ++r) {
+            ProcessTable workload = randomWorkload(rng, 1 + static_cast<int>(rng() % 16), 30, 9);
+            if (info.policy == Policy::EDF)
+                addDeadlines(rng, workload);
+            int quantum = 1 + static_cast<int>(rng() % 4);
+            ProcessorConfig machine;
+            machine.cpus = 2;
+            machine.stealOnIdle = false;
+            ProcessTable expected = workload;
+            referenceProcessors(expected, info.policy, quantum, 2);
+            Simulation simulation(workload);
+            simulation.configureProcessors(machine);
+            simulation.run(info.policy, quantum);
+            errors += !sameResults(expected, workload);
+        }
+        report(std::string("référence sur deux processeurs : ") + info.name, errors, rounds / 4);
+    }
+}
+
+// Modifier quelques processus après une simulation puis reprendre (rewind et
+// resume, ou run si rewind refuse) donne la simulation complète de la charge
+// modifiée, avec ou sans E/S dans la charge, comme batch --edit
+static void checkEdits(std::mt19937& rng, int rounds) {
+    for (bool io : {false, true}) {
+        for (const PolicyInfo& info : policyRegistry()) {
+            size_t errors = 0, resumed = 0;
+            for (int r = 0; r < rounds / 10; ++r) {
+                int n = 20 + static_cast<int>(rng() % 200);
+                ProcessTable workload = io ? randomIoWorkload(rng, n, 3 * n, 9) : randomWorkload(rng, n, 3 * n, 9);
+                int quantum = 1 + static_cast<int>(rng() % 4);
+                Simulation simulation(workload);
+                simulation.enableCheckpoints();
+                simulation.run(info.policy, quantum);
+
+                std::vector<std::uint32_t> edited;
+                std::vector<int> oldArrivals;
+                for (int k = 1 + static_cast<int>(rng() % 3); k > 0; --k) {
+                    std::uint32_t i = static_cast<std::uint32_t>(rng() % workload.size());
+                    if (workload.burstCount(i) > 1 ||
+                        std::find(edited.begin(), edited.end(), i) != edited.end())
+                        continue; // Comme batch : pas de modification d'un processus à E/S
+                    edited.push_back(i);
+                    oldArrivals.push_back(workload.arrivalTime[i]);
+                    workload.arrivalTime[i] = static_cast<int>(rng() % (3 * n + 1));
+                    workload.burstTime[i] = 1 + static_cast<int>(rng() % 9);
+                    workload.priority[i] = static_cast<int>(rng() % 4);
+                }
+                if (simulation.rewind(edited, oldArrivals)) {
+                    simulation.resume();
+                    resumed++;
+                } else {
+                    simulation.run(info.policy, quantum);
+                }
+
+                ProcessTable expected = workload;
+                Simulation(expected).run(info.policy, quantum);
+                errors += !sameResults(expected, workload);
+            }
+            report(std::string("modification puis reprise") + (io ? " avec E/S : " : " : ") + info.name, errors,
+                   rounds / 10);
+            if (!io && resumed == 0)
+                report(std::string("aucune reprise partielle : ") + info.name, 1, rounds / 10);
+        }
+    }
+}
+
+// Décisions d'admission de référence, en O(n²) : à chaque arrivée (dans
+// l'ordre, à date égale par indice), somme des parts des admis dont la
+// réservation court encore, avec les mêmes parts arrondies que le moteur
+static std::vector<bool> referenceAdmission(const ProcessTable& p, int cpus) {
+    const std::uint64_t unit = 1 << 20;
+    auto window = [&](size_t i) { return p.period[i] > 0 ? p.period[i] : p.deadline[i]; };
+    auto share = [&](size_t i) {
+        int w = p.period[i] > 0 ? std::min(p.deadline[i], p.period[i]) : p.deadline[i];
+        return (static_cast<std::uint64_t>(p.burstTime[i]) * unit + w - 1) / std::max(w, 1);
+    };
+    std::vector<size_t> order(p.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return p.arrivalTime[a] < p.arrivalTime[b]; });
+    std::vector<bool> admitted(p.size(), true);
+    std::vector<size_t> reserving;
+    for (size_t i : order) {
+        if (!p.hasDeadline(i))
+            continue;
+        std::uint64_t reserved = share(i);
+        for (size_t j : reserving)
+            if (static_cast<long long>(p.arrivalTime[j]) + window(j) > p.arrivalTime[i])
+                reserved += share(j);
+        admitted[i] = reserved <= static_cast<std::uint64_t>(cpus) * unit;
+        if (admitted[i])
+            reserving.push_back(i);
+    }
+    return admitted;
+}
+
+// Le contrôle d'admission refuse les mêmes processus que la référence, quels
+// que soient la politique et le nombre de processeurs, y compris avec des
+// arrivées négatives (que les lecteurs refusent, mais pas la table) ; sous EDF
+// sur un processeur et à partir de 0, aucun admis ne manque son échéance
+static void checkAdmission(std::mt19937& rng, int rounds) {
+    size_t errors = 0, late = 0;
+    for (int r = 0; r < rounds; ++r) {
+        ProcessTable workload = randomWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9);
+        addDeadlines(rng, workload);
+        for (size_t i = 0; i < workload.size(); ++i)
+            if (workload.hasDeadline(i) && rng() % 3 == 0)
+                workload.setDeadline(i, workload.deadline[i], workload.burstTime[i] + static_cast<int>(rng() % 30));
+        bool shifted = r % 4 == 0;
+        if (shifted)
+            for (int& arrival : workload.arrivalTime)
+                arrival -= 45;
+        const PolicyInfo& info = policyRegistry()[rng() % policyRegistry().size()];
+        ProcessorConfig machine;
+        machine.cpus = rng() % 2 == 0 ? 1 : 1 + static_cast<int>(rng() % 3);
+
+        Simulation simulation(workload);
+        simulation.configureProcessors(machine);
+        simulation.enableAdmission();
+        simulation.run(info.policy, 1 + static_cast<int>(rng() % 4));
+        std::vector<bool> expected = referenceAdmission(workload, machine.cpus);
+        bool wrong = false;
+        for (size_t i = 0; i < workload.size(); ++i) {
+            wrong |= expected[i] != (workload.turnaroundTime[i] >= 0);
+            if (info.policy == Policy::EDF && machine.cpus == 1 && !shifted && workload.hasDeadline(i) &&
+                workload.turnaroundTime[i] > workload.deadline[i])
+                late++;
+        }
+        errors += wrong;
+    }
+    report("contrôle d'admission : décisions de la référence", errors, rounds);
+    report("contrôle d'admission : échéances tenues sous edf", late, rounds);
+}
+
+// Avec des E/S et sur plusieurs processeurs, tous les processus se terminent,
+// la rotation se partage en attente, calcul et E/S, et l'attente, jamais
+// négative, contient le délai de première exécution
+static void checkIoAccounting(std::mt19937& rng, int rounds) {
+    for (const PolicyInfo& info : policyRegistry()) {
+        size_t errors = 0;
+        for (int r = 0; r < rounds / 4; ++r) {
+            ProcessTable workload = randomIoWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9);
+            ProcessorConfig machine;
+            machine.cpus = 1 + static_cast<int>(rng() % 4);
+            machine.balancePeriod = rng() % 2 == 0 ? 0 : 1 + static_cast<int>(rng() % 20);
+            machine.stealOnIdle = rng() % 2 == 0;
+            Simulation simulation(workload);
+            simulation.configureProcessors(machine);
+            simulation.run(info.policy, 1 + static_cast<int>(rng() % 4));
+            bool wrong = simulation.latencies().waiting.count() != workload.size();
+            for (size_t i = 0; i < workload.size(); ++i)
+                wrong |= workload.turnaroundTime[i] !=
+                             workload.waitingTime[i] + workload.burstTime[i] + workload.io(i) ||
+                         workload.responseTime[i] < 0 || workload.waitingTime[i] < workload.responseTime[i];
+            errors += wrong;
+        }
+        report(std::string("rotation = attente + calcul + E/S : ") + info.name, errors, rounds / 4);
+    }
+}
+
+// MLFQ réduite à un niveau de quantum q est le tourniquet de quantum q
+static void checkSingleLevelFeedback(std::mt19937& rng, int rounds) {
+    size_t errors = 0;
+    for (int r = 0; r < rounds; ++r) {
+        ProcessTable workload = r % 2 == 0 ? randomWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9)
+                                           : randomIoWorkload(rng, 1 + static_cast<int>(rng() % 30), 60, 9);
+        int quantum = 1 + static_cast<int>(rng() % 6);
+        FeedbackConfig feedback;
+        feedback.quanta = {quantum};
+        feedback.boostPeriod = static_cast<int>(rng() % 40);
+        ProcessTable expected = workload;
+        Simulation(expected).run(Policy::RoundRobin, quantum);
+        Simulation simulation(workload);
+        simulation.configureFeedback(feedback);
+        simulation.run(Policy::MLFQ, quantum);
+        errors += !sameResults(expected, workload);
+    }
+    report("mlfq à un niveau = rr", errors, rounds);
+}
+
+// Centiles de l'histogramme comparés aux valeurs triées : exacts jusqu'à 255,
+// par excès de moins de 1 % au-delà ; moyenne et fusion exactes
+static void checkPercentiles(std::mt19937& rng, int rounds) {
+    size_t errors = 0;
+    for (int r = 0; r < rounds; ++r) {
+        size_t n = 1 + rng() % 500;
+        int range = r % 3 == 0 ? 300 : r % 3 == 1 ? 100000 : INT_MAX;
+        std::vector<int> values(n);
+        LatencyHistogram histogram, first, second;
+        long long sum = 0;
+        for (size_t k = 0; k < n; ++k) {
+            values[k] = static_cast<int>(rng() % (static_cast<unsigned>(range) + 1u)) - (k % 17 == 0 ? 5 : 0);
+            histogram.record(values[k]);
+            (k % 2 == 0 ? first : second).record(values[k]);
+            values[k] = std::max(values[k], 0);
+            sum += values[k];
+        }
+        first.merge(second);
+        std::sort(values.begin(), values.end());
+        bool wrong = histogram.mean() != static_cast<double>(sum) / static_cast<double>(n) ||
+                     histogram.min() != values.front() || histogram.max() != values.back();
+        for (double fraction : {0.0, 0.25, 0.5, 0.9, 0.95, 0.99, 0.999, 1.0}) {
+            int exact = values[static_cast<size_t>(fraction * static_cast<double>(n - 1))];
+            int estimate = histogram.percentile(fraction);
+            wrong |= estimate != first.percentile(fraction) || estimate < exact ||
+                     (exact <= 255 ? estimate != exact : estimate - exact > exact / 100);
+        }
+        errors += wrong;
+    }
+    report("centiles des histogrammes", errors, rounds);
+}
+
+// Une simulation réutilisée d'une charge à l'autre par reload(), comme dans un
+// balayage, donne les résultats d'une simulation neuve
+static void checkReload(std::mt19937& rng, int rounds) {
+    size_t errors = 0;
+    ProcessTable scratch;
+    Simulation reused(scratch);
+    for (int r = 0; r < rounds; ++r) {
+        ProcessTable workload = r % 2 == 0 ? randomWorkload(rng, 1 + static_cast<int>(rng() % 200), 300, 9)
+                                           : randomIoWorkload(rng, 1 + static_cast<int>(rng() % 200), 300, 9);
+        const PolicyInfo& info = policyRegistry()[rng() % policyRegistry().size()];
+        ProcessorConfig machine;
+        machine.cpus = 1 + static_cast<int>(rng() % 3);
+        int quantum = 1 + static_cast<int>(rng() % 4);
+        if (info.policy == Policy::EDF)
+            addDeadlines(rng, workload);
+
+        scratch = workload;
+        reused.reload();
+        reused.configureProcessors(machine);
+        reused.run(info.policy, quantum);
+        Simulation fresh(workload);
+        fresh.configureProcessors(machine);
+        fresh.run(info.policy, quantum);
+        errors += !sameResults(workload, scratch) ||
+                  reused.latencies().waiting.mean() != fresh.latencies().waiting.mean();
+    }
+    report("simulation réutilisée par reload()", errors, rounds);
+}
+
+int main(int argc, char** argv) {
+    std::uint64_t seed = 1;
+    int rounds = 2000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--seed")
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (arg == "--rounds")
+            rounds = std::max(1, std::atoi(argv[i + 1]));
+        else {
+            std::cerr << "Option inconnue : " << arg << "\n";
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Option sans valeur : " << argv[argc - 1] << "\n";
+        return 1;
+    }
+
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+    checkAgainstReference(rng, rounds);
+    checkEdits(rng, rounds);
+    checkAdmission(rng, rounds);
+    checkIoAccounting(rng, rounds);
+    checkSingleLevelFeedback(rng, rounds);
+    checkPercentiles(rng, rounds);
+    checkReload(rng, rounds);
+    checkProcessorLoops(rng, rounds);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Files FIFO par niveau de priorité pour identifiants 0..n-1. Les files sont
+// chaînées à travers un tableau `next` (aucune allocation par insertion) et un
+// bitmap indique les niveaux non vides : le plus prioritaire est trouvé en O(1)
+// par recherche du premier bit à 1, comme dans l'ordonnanceur O(1) de Linux.
+// Le niveau 0 est le plus prioritaire. Comme pour IndexedHeap, le tableau `next`
+// peut être partagé par plusieurs files dont les éléments sont disjoints.
+class FeedbackQueue {
+public:
+    static constexpr int maxLevels = 64;
+
+private:
+    static constexpr std::uint32_t none = UINT32_MAX;
+
+    std::vector<std::uint32_t> ownNext;
+    std::uint32_t* next;             // Suivant de chaque identifiant dans sa file
+    std::uint32_t head[maxLevels];
+    std::uint32_t tail[maxLevels];
+    std::uint64_t nonEmpty = 0;      // Bit k à 1 si le niveau k a au moins un élément
+    size_t count = 0;
+
+    void clearLevels() {
+        for (int level = 0; level < maxLevels; ++level)
+            head[level] = tail[level] = none;
+    }
+
+public:
+    explicit FeedbackQueue(size_t capacity) : ownNext(capacity, none), next(ownNext.data()) {
+        clearLevels();
+    }
+
+    // `links` : une case par identifiant
+    explicit FeedbackQueue(std::uint32_t* links) : next(links) {
+        clearLevels();
+    }
+
+    FeedbackQueue(const FeedbackQueue&) = delete;
+    FeedbackQueue& operator=(const FeedbackQueue&) = delete;
+
+    bool empty() const {
+        return nonEmpty == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Niveau non vide le plus prioritaire (file non vide)
+    int highest() const {
+        return __builtin_ctzll(nonEmpty);
+    }
+
+    // Niveau non vide le moins prioritaire (file non vide)
+    int lowest() const {
+        return 63 - __builtin_clzll(nonEmpty);
+    }
+
+    std::uint32_t front(int level) const {
+        return head[level];
+    }
+
+    void pushBack(int level, std::uint32_t id) {
+        next[id] = none;
+        if (head[level] == none)
+            head[level] = id;
+        else
+            next[tail[level]] = id;
+        tail[level] = id;
+        nonEmpty |= std::uint64_t(1) << level;
+        count++;
+    }
+
+    // Remet en tête un processus interrompu avant la fin de son quantum
+    void pushFront(int level, std::uint32_t id) {
+        next[id] = head[level];
+        if (head[level] == none)
+            tail[level] = id;
+        head[level] = id;
+        nonEmpty |= std::uint64_t(1) << level;
+        count++;
+    }
+
+    void popFront(int level) {
+        std::uint32_t id = head[level];
+        head[level] = next[id];
+        if (head[level] == none) {
+            tail[level] = none;
+            nonEmpty &= ~(std::uint64_t(1) << level);
+        }
+        count--;
+    }
+
+    // Remontée générale : les files de tous les niveaux sont raccordées à la
+    // suite du niveau 0, dans l'ordre des niveaux. O(nombre de niveaux).
+    void boost() {
+        for (std::uint64_t rest = nonEmpty & ~std::uint64_t(1); rest != 0; rest &= rest - 1) {
+            int level = __builtin_ctzll(rest);
+            if (head[0] == none)
+                head[0] = head[level];
+            else
+                next[tail[0]] = head[level];
+            tail[0] = tail[level];
+            head[level] = tail[level] = none;
+        }
+        nonEmpty = nonEmpty != 0 ? 1 : 0;
+    }
+
+    // Contenu niveau par niveau, dans l'ordre de chaque file
+    void items(std::vector<std::uint32_t>& ids, std::vector<int>& levels) const {
+        ids.clear();
+        levels.clear();
+        for (std::uint64_t rest = nonEmpty; rest != 0; rest &= rest - 1) {
+            int level = __builtin_ctzll(rest);
+            for (std::uint32_t id = head[level]; id != none; id = next[id]) {
+                ids.push_back(id);
+                levels.push_back(level);
+            }
+        }
+    }
+};
@@ -0,0 +1,374 @@
+#pragma once
+
+#include <cairo.h>
+#include <cairo-svg.h>
+#include <cairo-pdf.h>
+#include <cmath>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include "process.h"
+#include "timeline.h"
+#include "simulation.h"
+
+// Couleurs des barres, choisies selon le pid
+static const double palette[][3] = {
+    {0.0, 0.0, 1.0},    // Bleu
+    {0.85, 0.33, 0.1},  // Orange
+    {0.47, 0.67, 0.19}, // Vert
+    {0.49, 0.18, 0.56}, // Violet
+    {0.93, 0.69, 0.13}, // Jaune
+    {0.3, 0.75, 0.93},  // Cyan
+};
+static const size_t paletteSize = sizeof(palette) / sizeof(palette[0]);
+
+// Attentes d'E/S, en gris clair sous les barres d'exécution
+static const double blockedColor[3] = {0.8, 0.8, 0.8};
+
+// Portion du diagramme à dessiner. Hors position de défilement, elle sert aussi
+// de clé au cache du calque statique de l'interface (voir sameLayout)
+struct GanttView {
+    double x, y;      // Position de défilement
+    int width, height;
+    double cell;      // Largeur d'une unité de temps en pixels
+    double rowHeight; // Hauteur d'une rangée, moins d'un pixel si elles sont très nombreuses
+    size_t rows;
+    int endTime;
+
+    // Même mise en page, à la position de défilement près
+    bool sameLayout(const GanttView& o) const {
+        return width == o.width && height == o.height && cell == o.cell && rowHeight == o.rowHeight &&
+               rows == o.rows && endTime == o.endTime;
+    }
+
+    // La vue `o` est entièrement dans celle-ci
+    bool contains(const GanttView& o) const {
+        return o.x >= x && o.y >= y && o.x + o.width <= x + width && o.y + o.height <= y + height;
+    }
+};
+
+// Diagramme de Gantt d'une simulation, dessiné sur n'importe quelle surface
+// cairo : la fenêtre de l'interface, ou une image, un SVG ou un PDF sans
+// affichage. Les chronologies sont lues sans copie, éventuellement pendant que
+// la simulation les remplit. Chaque passe ne parcourt que les segments de la
+// vue, et n'en dessine qu'un par colonne de pixels et par rangée : un
+// ordonnancement d'un million de segments ramené à la largeur d'une image
+// coûte un parcours, pas un million de rectangles.
+class GanttChart {
+public:
+    static constexpr int cellWidth = 30; // Largeur d'une unité de temps (zoom 1)
+    static constexpr int rowHeight = 20; // Hauteur de chaque rangée
+    static constexpr int xOffset = 70;   // Marge gauche (noms des rangées)
+    static constexpr int yOffset = 50;   // Marge haute (temps)
+
+    const ProcessTable* processes = nullptr;
+    const Timeline* timeline = nullptr;
+    std::vector<const Timeline*> lanes; // En multiprocesseur : une rangée par processeur
+    const Timeline* blocked = nullptr;  // Attentes d'E/S, sur les rangées des processus
+    int longestIo = 0;                  // Plus longue attente d'E/S : `blocked` est ordonnée par fin
+
+    GanttChart() = default;
+
+    // Diagramme du résultat d'une simulation (Simulation::schedule)
+    GanttChart(const ScheduleView& schedule, int io)
+        : processes(schedule.processes), timeline(schedule.timeline), lanes(schedule.lanes),
+          blocked(schedule.blocked), longestIo(io) {}
+
+    // Une rangée par processus, ou par processeur en multiprocesseur
+    size_t rows() const {
+        return lanes.empty() ? (processes != nullptr ? processes->size() : 0) : lanes.size();
+    }
+
+    std::string rowLabel(size_t row) const {
+        return lanes.empty() ? processes->name(row) : "CPU " + std::to_string(row);
+    }
+
+    int endTime() const {
+        int end = timeline != nullptr ? timeline->endTime() : 0;
+        for (const Timeline* lane : lanes)
+            end = std::max(end, lane->endTime());
+        return end;
+    }
+
+    // Plus petit pas parmi 1, 2, 5, 10, 20, 50... qui occupe au moins `minPixels`
+    static int niceStep(double cell, double minPixels) {
+        int step = 1;
+        while (step * cell < minPixels && step < 1000000000) {
+            if (step * 2 * cell >= minPixels)
+                return step * 2;
+            if (step * 5 * cell >= minPixels)
+                return step * 5;
+            step *= 10;
+        }
+        return step;
+    }
+
+    // Dessine la grille, les temps et les noms visibles dans la vue (fond transparent)
+    void renderStaticLayer(cairo_t *cr, const GanttView& view) const {
+        int endTime = view.endTime;
+        int t0 = std::max(0, static_cast<int>(std::floor((view.x - xOffset) / view.cell)));
+        int t1 = std::min(endTime, static_cast<int>(std::ceil((view.x + view.width - xOffset) / view.cell)));
+        int r0, r1;
+        visibleRows(view, r0, r1);
+        double left = xOffset - view.x;
+        double top = yOffset - view.y;
+
+        // Dessiner les en-têtes des temps, espacés pour rester lisibles
+        cairo_set_source_rgb(cr, 0, 0, 0); // Texte en noir
+        int labelStep = niceStep(view.cell, 30);
+        for (int t = t0 / labelStep * labelStep; t <= t1; t += labelStep) {
+            std::string timeLabel = std::to_string(t);
+            cairo_move_to(cr, left + t * view.cell + std::min(view.cell, 30.0) / 4, top - 10);
+            cairo_show_text(cr, timeLabel.c_str());
+        }
+
+        if (view.rows == 0)
+            return;
+
+        // Dessiner les lignes de la grille ; les lignes des rangées et leurs noms
+        // seulement s'il y a la place
+        cairo_set_line_width(cr, 1);
+        int gridStep = niceStep(view.cell, 4);
+        for (int t = t0 / gridStep * gridStep; t <= t1; t += gridStep) {
+            cairo_move_to(cr, left + t * view.cell, top + r0 * view.rowHeight);
+            cairo_line_to(cr, left + t * view.cell, top + r1 * view.rowHeight);
+        }
+        if (view.rowHeight >= 4) {
+            for (int row = r0; row <= r1; ++row) {
+                cairo_move_to(cr, left, top + row * view.rowHeight);
+                cairo_line_to(cr, left + endTime * view.cell, top + row * view.rowHeight); // Ligne horizontale
+            }
+        }
+        cairo_stroke(cr);
+
+        if (view.rowHeight < 10)
+            return;
+        for (int row = r0; row < r1; ++row) {
+            cairo_move_to(cr, 10 - view.x, top + row * view.rowHeight + view.rowHeight / 2);
+            cairo_show_text(cr, rowLabel(row).c_str());
+        }
+    }
+
+    // Dessine les barres des segments visibles : les attentes d'E/S puis les
+    // exécutions sur les rangées des processus, ou une rangée par processeur
+    void renderSegments(cairo_t *cr, const GanttView& view) const {
+        int r0, r1;
+        visibleRows(view, r0, r1);
+        if (r0 >= r1)
+            return;
+        if (lanes.empty()) {
+            if (blocked != nullptr)
+                renderTimeline(cr, view, *blocked, -1, r0, r1, longestIo, blockedColor);
+            if (timeline != nullptr)
+                renderTimeline(cr, view, *timeline, -1, r0, r1);
+            return;
+        }
+        // Multiprocesseur : seules les rangées visibles sont parcourues
+        for (int row = r0; row < r1 && row < static_cast<int>(lanes.size()); ++row)
+            renderTimeline(cr, view, *lanes[row], row, r0, r1);
+    }
+
+    // Vue du diagramme entier sur `width` pixels de large (0 : une cellule par
+    // unité de temps, dans la limite de maxSide). Un long ordonnancement est
+    // réduit à la largeur demandée ; les rangées rétrécissent pour que la
+    // hauteur ne dépasse pas maxSide.
+    GanttView fullView(int width = 0, int maxSide = 16384) const {
+        int end = std::max(1, endTime());
+        size_t count = rows();
+        if (width <= 0)
+            width = static_cast<int>(std::min<double>(2.0 * xOffset + static_cast<double>(end) * cellWidth, maxSide));
+        width = std::max(width, 2 * xOffset + 1);
+        double row = std::min<double>(rowHeight, (maxSide - yOffset) / static_cast<double>(count + 1));
+        int height = static_cast<int>(std::ceil(yOffset + (count + 1) * row));
+        return {0, 0, width, height, static_cast<double>(width - 2 * xOffset) / end, row, count, endTime()};
+    }
+
+    // Diagramme entier sur fond blanc
+    void render(cairo_t *cr, const GanttView& view) const {
+        cairo_set_source_rgb(cr, 1, 1, 1);
+        cairo_paint(cr);
+        renderSegments(cr, view);
+        renderStaticLayer(cr, view);
+    }
+
+    // Exporte le diagramme entier, au format donné par l'extension : .png, .svg ou .pdf
+    void exportTo(const std::string& path, int width = 0) const {
+        std::string extension = path.substr(std::min(path.size(), path.rfind('.') + 1));
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        GanttView view = fullView(width);
+        cairo_surface_t *surface;
+        if (extension == "png")
+            surface = cairo_image_surface_create(CAIRO_FORMAT_RGB24, view.width, view.height);
+        else if (extension == "svg")
+            surface = cairo_svg_surface_create(path.c_str(), view.width, view.height);
+        else if (extension == "pdf")
+            surface = cairo_pdf_surface_create(path.c_str(), view.width, view.height);
+        else
+            throw std::runtime_error(path + ": format inconnu, attendu .png, .svg ou .pdf");
+
+        cairo_t *cr = cairo_create(surface);
+        render(cr, view);
+        cairo_destroy(cr);
+        cairo_status_t status = cairo_surface_status(surface);
+        if (status == CAIRO_STATUS_SUCCESS && extension == "png")
+            status = cairo_surface_write_to_png(surface, path.c_str());
+        cairo_surface_finish(surface);
+        if (status == CAIRO_STATUS_SUCCESS)
+            status = cairo_surface_status(surface);
+        cairo_surface_destroy(surface);
+        if (status != CAIRO_STATUS_SUCCESS)
+            throw std::runtime_error(path + ": " + cairo_status_to_string(status));
+    }
+
+private:
+    void visibleRows(const GanttView& view, int& r0, int& r1) const {
+        r0 = std::max(0, static_cast<int>((view.y - yOffset) / view.rowHeight));
+        r1 = static_cast<int>(std::min<double>(static_cast<double>(view.rows),
+                                               std::floor((view.y + view.height - yOffset) / view.rowHeight) + 1));
+    }
+
+    // Segments d'une chronologie, sur la rangée `lane`, ou sur celle de leur
+    // processus si `lane` vaut -1 ; la couleur est celle du processus, sauf
+    // `color`. Une chronologie ordonnée par fin seulement (attentes d'E/S) donne
+    // la longueur `reach` de son plus long segment pour arrêter le parcours.
+    // Les rectangles sont regroupés par couleur : un remplissage par couleur.
+    void renderTimeline(cairo_t *cr, const GanttView& view, const Timeline& source, int lane, int r0, int r1,
+                        int reach = 0, const double *color = nullptr) const {
+        if (source.empty())
+            return;
+        int t0 = std::max(0, static_cast<int>(std::floor((view.x - xOffset) / view.cell)));
+        double t1 = (view.x + view.width - xOffset) / view.cell;
+
+        struct Bar {
+            double left, top, width;
+            int pid;
+        };
+        std::vector<Bar> bars[paletteSize];
+        std::vector<double> lastPixel(r1 - r0, -1e9);
+        for (size_t i = source.firstEndingAfter(t0); i < source.size(); ++i) {
+            const Segment& segment = source[i];
+            if (segment.start >= t1) {
+                if (segment.end - reach >= t1)
+                    break; // Aucun segment suivant ne commence dans la vue
+                continue;
+            }
+            int row = lane >= 0 ? lane : segment.pid - 1; // Les pids sont numérotés à partir de 1
+            if (row < r0 || row >= r1)
+                continue;
+
+            double left = std::floor(xOffset + segment.start * view.cell - view.x);
+            double right = std::max(left + 1, std::floor(xOffset + segment.end * view.cell - view.x));
+            double& last = lastPixel[row - r0];
+            if (right <= last)
+                continue; // Segment plus fin qu'un pixel déjà couvert
+            left = std::max(left, last);
+            last = right;
+            bars[color != nullptr ? 0 : segment.pid % paletteSize].push_back(
+                {left, yOffset + row * view.rowHeight - view.y, right - left, segment.pid});
+        }
+
+        for (size_t c = 0; c < paletteSize; ++c) {
+            if (bars[c].empty())
+                continue;
+            const double *fill = color != nullptr ? color : palette[c];
+            cairo_set_source_rgb(cr, fill[0], fill[1], fill[2]);
+            for (const Bar& bar : bars[c])
+                cairo_rectangle(cr, bar.left, bar.top, bar.width, view.rowHeight);
+            cairo_fill(cr);
+        }
+
+        // Sur la rangée d'un processeur, le pid s'il y a la place de l'écrire
+        if (lane < 0 || view.rowHeight < 10)
+            return;
+        cairo_set_source_rgb(cr, 1, 1, 1);
+        for (size_t c = 0; c < paletteSize; ++c) {
+            for (const Bar& bar : bars[c]) {
+                if (bar.width < 30)
+                    continue;
+                std::string label = std::to_string(bar.pid);
+                cairo_move_to(cr, bar.left + 3, bar.top + view.rowHeight * 0.7);
+                cairo_show_text(cr, label.c_str());
+            }
+        }
+    }
+};
+
+// Plus longue attente d'E/S de la table, pour GanttChart::longestIo
+inline int longestIoBurst(const ProcessTable& processes) {
+    int longest = 0;
+    for (size_t i = 0; i < processes.size(); ++i)
+        for (int k = 1; k < processes.burstCount(i); k += 2)
+            longest = std::max(longest, processes.burst(i, k));
+    return longest;
+}
+
+// Un ordonnancement à simuler puis à exporter
+struct GanttJob {
+    const ProcessTable* workload; // Partagée en lecture seule entre les threads
+    Policy policy;
+    int quantum;
+    ProcessorConfig machine;
+    std::string path;
+    int width = 0;
+    FeedbackConfig feedback;      // Niveaux de MLFQ
+    bool admission = false;       // Contrôle d'admission des processus à échéance
+};
+
+// Simule et exporte plusieurs ordonnancements en parallèle, chaque thread avec
+// sa propre simulation et ses propres chronologies, réutilisées d'un
+// ordonnancement à l'autre ; la première erreur est relancée à la fin.
+// `profile`, s'il est donné, relève la simulation et le rendu de chacun.
+inline void exportSchedules(const std::vector<GanttJob>& jobs, unsigned threads = 0, Profile* profile = nullptr) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(jobs.size(), 1)));
+
+    std::atomic<size_t> next(0);
+    std::vector<std::exception_ptr> errors(jobs.size());
+    auto worker = [&]() {
+        ProcessTable scratch;
+        Timeline timeline, blocked;
+        std::vector<std::unique_ptr<Timeline>> lanes;
+        Simulation simulation(scratch, &timeline, nullptr, profile);
+        simulation.recordBlocked(&blocked);
+        for (size_t j = next++; j < jobs.size(); j = next++) {
+            const GanttJob& job = jobs[j];
+            try {
+                scratch = *job.workload;
+                while (lanes.size() < static_cast<size_t>(job.machine.cpus))
+                    lanes.push_back(std::make_unique<Timeline>());
+                std::vector<Timeline*> cpuLanes;
+                if (job.machine.cpus > 1)
+                    for (int c = 0; c < job.machine.cpus; ++c)
+                        cpuLanes.push_back(lanes[c].get());
+
+                simulation.reload();
+                simulation.configureFeedback(job.feedback);
+                simulation.configureProcessors(job.machine, cpuLanes);
+                simulation.enableAdmission(job.admission);
+                simulation.run(job.policy, job.quantum);
+                ScopedPhase rendering(profile, "render");
+                GanttChart(simulation.schedule(), longestIoBurst(scratch)).exportTo(job.path, job.width);
+            } catch (...) {
+                errors[j] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool)
+        thread.join();
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
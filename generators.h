@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Générateurs de charges synthétiques reproductibles : une même graine produit
+// toujours la même suite de processus (arrivée, durée, priorité).
+
+// Loi des dates d'arrivée
+enum class ArrivalModel {
+    Poisson, // Inter-arrivées exponentielles
+    Bursty   // Rafales d'arrivées rapprochées séparées de longues périodes creuses
+};
+
+// Loi des durées d'exécution
+enum class BurstModel {
+    Exponential,
+    Pareto // Queue lourde : quelques très longs processus
+};
+
+// Loi des priorités
+enum class PriorityModel {
+    Uniform,
+    Skewed // Loi de Zipf : la plupart des processus ont une priorité faible
+};
+
+struct WorkloadSpec {
+    std::string name;
+    ArrivalModel arrivals = ArrivalModel::Poisson;
+    BurstModel bursts = BurstModel::Exponential;
+    PriorityModel priorities = PriorityModel::Uniform;
+    double load = 0.9;        // Charge moyenne visée (durée moyenne / inter-arrivée moyenne)
+    double meanBurst = 10.0;  // Durée moyenne d'un processus
+    double paretoShape = 1.5; // Exposant de la loi de Pareto (> 1)
+    int burstLength = 200;    // Processus par rafale (modèle Bursty)
+    int priorityLevels = 10;
+    double zipfExponent = 1.2;
+};
+
+class WorkloadGenerator {
+private:
+    WorkloadSpec spec;
+    std::mt19937_64 rng;
+    std::uniform_real_distribution<double> uniform{0.0, 1.0};
+    std::vector<double> priorityCdf; // Fonction de répartition des priorités
+    double clock = 0.0;
+    int inBurst = 0;                 // Arrivées restantes dans la rafale courante
+
+    // Tirage dans ]0, 1] pour éviter log(0)
+    double draw() {
+        return 1.0 - uniform(rng);
+    }
+
+    double exponential(double mean) {
+        return -mean * std::log(draw());
+    }
+
+    int nextArrival() {
+        double meanGap = spec.meanBurst / spec.load;
+        if (spec.arrivals == ArrivalModel::Poisson) {
+            clock += exponential(meanGap);
+        } else {
+            // Une rafale arrive dix fois plus vite que la moyenne, puis le creux
+            // rattrape le temps pour conserver la charge moyenne visée
+            if (inBurst == 0) {
+                clock += exponential(meanGap * spec.burstLength * 0.9);
+                inBurst = spec.burstLength;
+            }
+            clock += exponential(meanGap * 0.1);
+            inBurst--;
+        }
+        return static_cast<int>(clock);
+    }
+
+    int nextBurst() {
+        double value;
+        if (spec.bursts == BurstModel::Exponential) {
+            value = exponential(spec.meanBurst);
+        } else {
+            // Pareto(xm, a) de moyenne meanBurst : xm = meanBurst * (a - 1) / a
+            double a = spec.paretoShape;
+            double xm = spec.meanBurst * (a - 1.0) / a;
+            value = xm / std::pow(draw(), 1.0 / a);
+        }
+        // Bornée pour rester dans un int même sur les queues extrêmes
+        return static_cast<int>(std::min(std::max(std::ceil(value), 1.0), 1e6));
+    }
+
+    int nextPriority() {
+        if (spec.priorities == PriorityModel::Uniform)
+            return static_cast<int>(uniform(rng) * spec.priorityLevels);
+        double u = uniform(rng);
+        int level = 0;
+        while (level + 1 < spec.priorityLevels && priorityCdf[level] < u)
+            level++;
+        // Niveau 0 le plus probable, mais c'est la priorité la plus faible (valeur haute)
+        return spec.priorityLevels - 1 - level;
+    }
+
+public:
+    WorkloadGenerator(const WorkloadSpec& s, std::uint64_t seed) : spec(s), rng(seed) {
+        double total = 0.0;
+        for (int k = 0; k < spec.priorityLevels; ++k)
+            total += 1.0 / std::pow(k + 1, spec.zipfExponent);
+        double cumulative = 0.0;
+        for (int k = 0; k < spec.priorityLevels; ++k) {
+            cumulative += 1.0 / std::pow(k + 1, spec.zipfExponent) / total;
+            priorityCdf.push_back(cumulative);
+        }
+    }
+
+    // Appelle sink(arrivée, durée, priorité) pour `count` processus
+    template <typename Sink>
+    void generate(size_t count, Sink sink) {
+        for (size_t i = 0; i < count; ++i) {
+            int arrival = nextArrival();
+            int burst = nextBurst();
+            sink(arrival, burst, nextPriority());
+        }
+    }
+};
+
+// Scénarios de référence utilisés par le banc d'essai
+inline std::vector<WorkloadSpec> standardWorkloads() {
+    std::vector<WorkloadSpec> specs(4);
+    specs[0].name = "poisson";
+    specs[1].name = "pareto";
+    specs[1].bursts = BurstModel::Pareto;
+    specs[2].name = "rafales";
+    specs[2].arrivals = ArrivalModel::Bursty;
+    specs[2].bursts = BurstModel::Pareto;
+    specs[3].name = "priorites";
+    specs[3].priorities = PriorityModel::Skewed;
+    return specs;
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+
+// Histogramme de latences à mémoire constante, à la manière de HDR Histogram :
+// les 256 premières valeurs ont chacune leur compteur, au-delà les classes
+// doublent de largeur à chaque puissance de deux, avec 128 classes par
+// puissance. Un centile est donc exact jusqu'à 255 et à moins de 1 % près
+// au-delà (deux chiffres significatifs), pour toute valeur positive d'un int,
+// avec 3 200 compteurs quel que soit le nombre de processus enregistrés.
+// Deux histogrammes s'additionnent (merge), par exemple ceux de simulations
+// exécutées en parallèle ou de plusieurs charges.
+class LatencyHistogram {
+public:
+    static constexpr int subBucketBits = 8;
+    static constexpr int subBucketCount = 1 << subBucketBits;
+    static constexpr int subBucketHalf = subBucketCount / 2;
+    static constexpr int bucketCount = subBucketCount + (31 - subBucketBits) * subBucketHalf;
+
+private:
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total = 0;
+    long long sum = 0;
+    int low = INT_MAX;
+    int high = 0;
+
+    static int bucketOf(int value) {
+        if (value < subBucketCount)
+            return value;
+        int shift = (31 - __builtin_clz(static_cast<unsigned>(value))) - (subBucketBits - 1);
+        return subBucketCount + (shift - 1) * subBucketHalf + ((value >> shift) - subBucketHalf);
+    }
+
+    // Plus grande valeur rangée dans la classe `bucket`
+    static int highestIn(int bucket) {
+        if (bucket < subBucketCount)
+            return bucket;
+        int k = bucket - subBucketCount;
+        int shift = k / subBucketHalf + 1;
+        long long first = static_cast<long long>(k % subBucketHalf + subBucketHalf) << shift;
+        long long last = first + (1LL << shift) - 1;
+        return last > INT_MAX ? INT_MAX : static_cast<int>(last);
+    }
+
+public:
+    LatencyHistogram() : counts(bucketCount, 0) {}
+
+    // Les valeurs négatives comptent pour 0
+    void record(int value) {
+        if (value < 0)
+            value = 0;
+        counts[bucketOf(value)]++;
+        total++;
+        sum += value;
+        low = value < low ? value : low;
+        high = value > high ? value : high;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (int b = 0; b < bucketCount; ++b)
+            counts[b] += other.counts[b];
+        total += other.total;
+        sum += other.sum;
+        low = other.low < low ? other.low : low;
+        high = other.high > high ? other.high : high;
+    }
+
+    void clear() {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        sum = 0;
+        low = INT_MAX;
+        high = 0;
+    }
+
+    std::uint64_t count() const {
+        return total;
+    }
+
+    long long sumOfValues() const {
+        return sum;
+    }
+
+    int min() const {
+        return total == 0 ? 0 : low;
+    }
+
+    int max() const {
+        return high;
+    }
+
+    double mean() const {
+        return total == 0 ? 0.0 : static_cast<double>(sum) / total;
+    }
+
+    // Valeur au rang floor(fraction * (n - 1)) + 1 des valeurs triées, comme
+    // std::nth_element sur toutes les valeurs, à la précision des classes près
+    int percentile(double fraction) const {
+        if (total == 0)
+            return 0;
+        std::uint64_t rank = static_cast<std::uint64_t>(fraction * (total - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (int b = 0; b < bucketCount; ++b) {
+            seen += counts[b];
+            if (seen >= rank)
+                return highestIn(b) < high ? highestIn(b) : high;
+        }
+        return high;
+    }
+};
+
+// Histogrammes des trois métriques d'une simulation, alimentés à chaque fin
+// de processus
+struct LatencySummary {
+    LatencyHistogram waiting;
+    LatencyHistogram turnaround;
+    LatencyHistogram response;
+
+    void record(int waitingTime, int turnaroundTime, int responseTime) {
+        waiting.record(waitingTime);
+        turnaround.record(turnaroundTime);
+        response.record(responseTime);
+    }
+
+    void merge(const LatencySummary& other) {
+        waiting.merge(other.waiting);
+        turnaround.merge(other.turnaround);
+        response.merge(other.response);
+    }
+
+    void clear() {
+        waiting.clear();
+        turnaround.clear();
+        response.clear();
+    }
+};
+
+// Respect des échéances : retard des processus terminés qui en ont une (fin
+// moins échéance, négatif s'ils finissent en avance) et processus refusés par
+// le contrôle d'admission. Les centiles portent sur le retard compté à 0 pour
+// les processus à l'heure ; moyenne et extrêmes sur le retard signé.
+struct DeadlineSummary {
+    std::uint64_t missed = 0;
+    std::uint64_t rejected = 0;
+    LatencyHistogram tardiness;
+    long long latenessSum = 0;
+    int minLateness = INT_MAX;
+    int maxLateness = INT_MIN;
+
+    void record(int lateness) {
+        tardiness.record(lateness);
+        missed += lateness > 0;
+        latenessSum += lateness;
+        minLateness = lateness < minLateness ? lateness : minLateness;
+        maxLateness = lateness > maxLateness ? lateness : maxLateness;
+    }
+
+    // Processus terminés avec une échéance
+    std::uint64_t count() const {
+        return tardiness.count();
+    }
+
+    double meanLateness() const {
+        return count() == 0 ? 0.0 : static_cast<double>(latenessSum) / count();
+    }
+
+    void merge(const DeadlineSummary& other) {
+        missed += other.missed;
+        rejected += other.rejected;
+        tardiness.merge(other.tardiness);
+        latenessSum += other.latenessSum;
+        minLateness = other.minLateness < minLateness ? other.minLateness : minLateness;
+        maxLateness = other.maxLateness > maxLateness ? other.maxLateness : maxLateness;
+    }
+
+    // Sur place : les compteurs de l'histogramme sont gardés
+    void clear() {
+        missed = 0;
+        rejected = 0;
+        tardiness.clear();
+        latenessSum = 0;
+        minLateness = INT_MAX;
+        maxLateness = INT_MIN;
+    }
+};
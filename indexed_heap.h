@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "arena.h"
+
+// Tas binaire adressable sur des identifiants 0..n-1 : chaque élément connaît sa
+// position, ce qui permet de modifier sa clé (decreaseKey) ou de le retirer en
+// O(log n) sans parcourir le tas. `before(a, b)` indique si a doit sortir avant b.
+//
+// Le tableau des positions peut être fourni par l'appelant : plusieurs tas dont
+// les éléments sont disjoints (les files des prêts des processeurs) le partagent
+// alors, au lieu d'en allouer un de taille n chacun. Avec une arène, les
+// tableaux du tas y sont pris et disparaissent avec elle.
+template <typename Before>
+class IndexedHeap {
+public:
+    static constexpr std::uint32_t absent = UINT32_MAX;
+
+private:
+    ArenaVector<std::uint32_t> heap;
+    ArenaVector<std::uint32_t> ownPositions;
+    std::uint32_t* position;             // Position de chaque identifiant dans le tas
+    Before before;
+
+    void place(size_t i, std::uint32_t id) {
+        heap[i] = id;
+        position[id] = static_cast<std::uint32_t>(i);
+    }
+
+    void siftUp(size_t i) {
+        std::uint32_t id = heap[i];
+        while (i > 0) {
+            size_t parent = (i - 1) / 2;
+            if (!before(id, heap[parent]))
+                break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, id);
+    }
+
+    void siftDown(size_t i) {
+        std::uint32_t id = heap[i];
+        size_t n = heap.size();
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= n)
+                break;
+            if (child + 1 < n && before(heap[child + 1], heap[child]))
+                child++;
+            if (!before(heap[child], id))
+                break;
+            place(i, heap[child]);
+            i = child;
+        }
+        place(i, id);
+    }
+
+public:
+    IndexedHeap(size_t capacity, Before b, Arena* arena = nullptr)
+        : heap(ArenaAllocator<std::uint32_t>(arena)), ownPositions(capacity, absent, ArenaAllocator<std::uint32_t>(arena)),
+          position(ownPositions.data()), before(std::move(b)) {
+        heap.reserve(capacity);
+    }
+
+    // `positions` : une case par identifiant, toutes à `absent`
+    IndexedHeap(std::uint32_t* positions, Before b, Arena* arena = nullptr)
+        : heap(ArenaAllocator<std::uint32_t>(arena)), position(positions), before(std::move(b)) {}
+
+    IndexedHeap(const IndexedHeap&) = delete;
+    IndexedHeap& operator=(const IndexedHeap&) = delete;
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    size_t size() const {
+        return heap.size();
+    }
+
+    bool contains(std::uint32_t id) const {
+        return position[id] != absent;
+    }
+
+    // Éléments présents, dans l'ordre du tas
+    const ArenaVector<std::uint32_t>& items() const {
+        return heap;
+    }
+
+    std::uint32_t top() const {
+        return heap.front();
+    }
+
+    void push(std::uint32_t id) {
+        heap.push_back(id);
+        siftUp(heap.size() - 1);
+    }
+
+    void pop() {
+        erase(heap.front());
+    }
+
+    void erase(std::uint32_t id) {
+        size_t i = position[id];
+        position[id] = absent;
+        std::uint32_t last = heap.back();
+        heap.pop_back();
+        if (i < heap.size()) {
+            place(i, last);
+            update(last);
+        }
+    }
+
+    // La clé de `id` s'est améliorée : il ne peut que remonter
+    void decreaseKey(std::uint32_t id) {
+        siftUp(position[id]);
+    }
+
+    // La clé de `id` a changé dans un sens quelconque
+    void update(std::uint32_t id) {
+        size_t i = position[id];
+        siftUp(i);
+        if (position[id] == i)
+            siftDown(i);
+    }
+
+    void clear() {
+        for (std::uint32_t id : heap)
+            position[id] = absent;
+        heap.clear();
+    }
+};
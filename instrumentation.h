@@ -0,0 +1,220 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <ostream>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+
+// Instrumentation du cœur de l'ordonnanceur, activée à la compilation par
+// -DSCHEDULER_INSTRUMENTATION. Sans ce drapeau, `instrumented` est faux et
+// tous les relevés sont écartés par `if constexpr` : la boucle de simulation
+// compilée est exactement celle d'un build sans instrumentation.
+#ifdef SCHEDULER_INSTRUMENTATION
+inline constexpr bool instrumented = true;
+#else
+inline constexpr bool instrumented = false;
+#endif
+
+// Compteurs d'événements de la boucle de simulation, tous processeurs confondus
+struct SchedulerCounters {
+    std::uint64_t contextSwitches = 0; // Un processeur passe d'un processus à un autre
+    std::uint64_t preemptions = 0;     // ... alors que le précédent n'avait pas fini sa rafale
+    std::uint64_t pushes = 0;          // Entrées en file des prêts : arrivées, réveils,
+                                       // remises en file et migrations
+    std::uint64_t pops = 0;            // Processus choisis par pick()
+    std::size_t maxDepth = 0;          // Plus longue file des prêts d'un processeur
+    std::uint64_t idleGaps = 0;        // Inactivités d'un processeur avant une tranche
+    long long idleTime = 0;            // Leur durée totale, en unités de temps
+
+    void merge(const SchedulerCounters& other) {
+        contextSwitches += other.contextSwitches;
+        preemptions += other.preemptions;
+        pushes += other.pushes;
+        pops += other.pops;
+        maxDepth = std::max(maxDepth, other.maxDepth);
+        idleGaps += other.idleGaps;
+        idleTime += other.idleTime;
+    }
+};
+
+// Relevés d'un programme : durée de chaque phase (lecture, tri, simulation,
+// agrégation, rendu...) et compteurs cumulés des simulations. Partagé entre
+// threads, par exemple ceux d'un balayage : chaque phase note le sien.
+class Profile {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Phase {
+        const char* name;
+        long long start;    // Nanosecondes depuis la création du relevé
+        long long duration;
+        unsigned thread;    // 0 : premier thread rencontré, puis dans l'ordre d'apparition
+    };
+
+private:
+    mutable std::mutex lock;
+    Clock::time_point origin = Clock::now();
+    std::vector<Phase> phaseList;
+    std::vector<std::thread::id> threads;
+    SchedulerCounters total;
+    size_t simulations = 0;
+
+    unsigned threadIndex(std::thread::id id) {
+        auto found = std::find(threads.begin(), threads.end(), id);
+        if (found != threads.end())
+            return static_cast<unsigned>(found - threads.begin());
+        threads.push_back(id);
+        return static_cast<unsigned>(threads.size() - 1);
+    }
+
+    static FILE* create(const std::string& path) {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (file == nullptr)
+            throw std::runtime_error(path + " : impossible de créer le fichier");
+        return file;
+    }
+
+    static void close(FILE* file, const std::string& path) {
+        bool ok = std::ferror(file) == 0;
+        if (std::fclose(file) != 0 || !ok)
+            throw std::runtime_error(path + " : erreur d'écriture");
+    }
+
+    // Compteurs sous forme d'objet JSON, sans accolades
+    static void writeCounters(FILE* file, const SchedulerCounters& c) {
+        std::fprintf(file,
+                     "\"context_switches\": %llu, \"preemptions\": %llu, \"queue_pushes\": %llu, "
+                     "\"queue_pops\": %llu, \"max_queue_depth\": %zu, \"idle_gaps\": %llu, \"idle_time\": %lld",
+                     static_cast<unsigned long long>(c.contextSwitches),
+                     static_cast<unsigned long long>(c.preemptions), static_cast<unsigned long long>(c.pushes),
+                     static_cast<unsigned long long>(c.pops), c.maxDepth,
+                     static_cast<unsigned long long>(c.idleGaps), c.idleTime);
+    }
+
+    // Nombre et durée totale de chaque phase, par nom
+    std::map<std::string, std::pair<size_t, long long>> totals() const {
+        std::map<std::string, std::pair<size_t, long long>> byName;
+        for (const Phase& phase : phaseList) {
+            auto& entry = byName[phase.name];
+            entry.first++;
+            entry.second += phase.duration;
+        }
+        return byName;
+    }
+
+public:
+    void record(const char* name, Clock::time_point start, Clock::time_point end) {
+        std::lock_guard<std::mutex> guard(lock);
+        phaseList.push_back({name, std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count(),
+                             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                             threadIndex(std::this_thread::get_id())});
+    }
+
+    // Compteurs d'une simulation terminée
+    void add(const SchedulerCounters& counters) {
+        std::lock_guard<std::mutex> guard(lock);
+        total.merge(counters);
+        simulations++;
+    }
+
+    SchedulerCounters counters() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return total;
+    }
+
+    std::vector<Phase> phases() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return phaseList;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard(lock);
+        origin = Clock::now();
+        phaseList.clear();
+        threads.clear();
+        total = SchedulerCounters();
+        simulations = 0;
+    }
+
+    // Résumé lisible : durée cumulée de chaque phase, puis les compteurs
+    void print(std::ostream& out) const {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const auto& [name, entry] : totals())
+            out << "Phase " << name << " : " << entry.second / 1e6 << " ms (" << entry.first << " fois)\n";
+        out << simulations << " simulations : " << total.contextSwitches << " changements de contexte, "
+            << total.preemptions << " préemptions, " << total.pushes << " entrées et " << total.pops
+            << " sorties de file (profondeur max " << total.maxDepth << "), " << total.idleGaps
+            << " inactivités (" << total.idleTime << " unités)\n";
+    }
+
+    // Résumé JSON : compteurs, puis nombre et durée cumulée de chaque phase
+    void writeJson(const std::string& path) const {
+        std::lock_guard<std::mutex> guard(lock);
+        FILE* file = create(path);
+        std::fprintf(file, "{\n  \"simulations\": %zu,\n  \"counters\": {", simulations);
+        writeCounters(file, total);
+        std::fprintf(file, "},\n  \"phases\": {");
+        bool first = true;
+        for (const auto& [name, entry] : totals()) {
+            std::fprintf(file, "%s\n    \"%s\": {\"count\": %zu, \"total_ms\": %.6f}", first ? "" : ",",
+                         name.c_str(), entry.first, entry.second / 1e6);
+            first = false;
+        }
+        std::fprintf(file, "\n  }\n}\n");
+        close(file, path);
+    }
+
+    // Format « Trace Event » de Chrome (chrome://tracing, Perfetto) : une
+    // tranche par phase sur la ligne de son thread, et les compteurs à la fin
+    void writeChromeTrace(const std::string& path) const {
+        std::lock_guard<std::mutex> guard(lock);
+        FILE* file = create(path);
+        std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+        long long end = 0;
+        for (const Phase& phase : phaseList) {
+            std::fprintf(file,
+                         "{\"name\": \"%s\", \"cat\": \"phase\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+                         "\"pid\": 1, \"tid\": %u},\n",
+                         phase.name, phase.start / 1e3, phase.duration / 1e3, phase.thread);
+            end = std::max(end, phase.start + phase.duration);
+        }
+        std::fprintf(file, "{\"name\": \"scheduler\", \"ph\": \"C\", \"ts\": %.3f, \"pid\": 1, \"args\": {",
+                     end / 1e3);
+        writeCounters(file, total);
+        std::fprintf(file, "}}\n]}\n");
+        close(file, path);
+    }
+};
+
+// Chronomètre d'une phase, enregistrée à la sortie de la portée. Ne fait rien
+// sans instrumentation ou sans relevé.
+class ScopedPhase {
+private:
+    Profile* profile;
+    const char* name;
+    Profile::Clock::time_point start;
+
+public:
+    ScopedPhase(Profile* p, const char* phase) : profile(p), name(phase) {
+        if constexpr (instrumented)
+            if (profile != nullptr)
+                start = Profile::Clock::now();
+    }
+
+    ~ScopedPhase() {
+        if constexpr (instrumented)
+            if (profile != nullptr)
+                profile->record(name, start, Profile::Clock::now());
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Fichier mappé en lecture seule pour une lecture séquentielle en flux : le
+// noyau lit en avance, et les pages déjà consommées lui sont rendues par blocs
+// pour ne jamais garder tout le fichier en mémoire, quelle que soit sa taille.
+class MappedFile {
+private:
+    static const size_t releaseChunk = 64 << 20; // Pages rendues par blocs de 64 Mio
+
+    std::string path;
+    int fd = -1;
+    const char* bytes = nullptr;
+    size_t length = 0;
+    size_t released = 0; // Octets déjà rendus au noyau
+
+public:
+    explicit MappedFile(const std::string& filename) : path(filename) {
+        fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            fail("impossible d'ouvrir le fichier");
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            fail("impossible de lire la taille du fichier");
+        }
+        length = static_cast<size_t>(st.st_size);
+        if (length > 0) {
+            void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                close(fd);
+                fail("échec de mmap");
+            }
+            bytes = static_cast<const char*>(mapping);
+            madvise(mapping, length, MADV_SEQUENTIAL);
+        }
+    }
+
+    ~MappedFile() {
+        if (bytes != nullptr)
+            munmap(const_cast<char*>(bytes), length);
+        if (fd >= 0)
+            close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const {
+        return bytes;
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    // Erreur préfixée du nom du fichier, et de la ligne si elle est connue
+    [[noreturn]] void fail(const std::string& message, size_t line = 0) const {
+        if (line > 0)
+            throw std::runtime_error(path + ":" + std::to_string(line) + ": " + message);
+        throw std::runtime_error(path + ": " + message);
+    }
+
+    // Libère les pages entièrement consommées avant `offset`
+    void releaseUpTo(size_t offset) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t end = offset / page * page;
+        if (end >= released + releaseChunk) {
+            madvise(const_cast<char*>(bytes) + released, end - released, MADV_DONTNEED);
+            released = end;
+        }
+    }
+};
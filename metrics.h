@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <climits>
+#include "process.h"
+#include "histogram.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Statistiques d'une colonne de la table des processus
+struct ColumnStats {
+    long long sum = 0;
+    int min = 0;
+    int max = 0;
+    double mean = 0.0;
+};
+
+// Agrégats calculés après la simulation
+struct RunMetrics {
+    ColumnStats waiting;
+    ColumnStats turnaround;
+    ColumnStats response;
+};
+
+// Somme (sur 64 bits), minimum et maximum d'une colonne d'entiers 32 bits.
+// Les colonnes étant contiguës, le calcul se fait par blocs SIMD : 8 valeurs par
+// itération avec AVX2, 4 avec SSE2, puis un reliquat scalaire.
+inline ColumnStats columnStats(const int* values, size_t n) {
+    ColumnStats stats;
+    if (n == 0)
+        return stats;
+
+    long long sum = 0;
+    int low = INT_MAX;
+    int high = INT_MIN;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i vsum0 = _mm256_setzero_si256();
+    __m256i vsum1 = _mm256_setzero_si256();
+    __m256i vmin = _mm256_set1_epi32(INT_MAX);
+    __m256i vmax = _mm256_set1_epi32(INT_MIN);
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        vmin = _mm256_min_epi32(vmin, v);
+        vmax = _mm256_max_epi32(vmax, v);
+        // Extension à 64 bits pour que la somme ne déborde pas
+        vsum0 = _mm256_add_epi64(vsum0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        vsum1 = _mm256_add_epi64(vsum1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) long long sums[4];
+    alignas(32) int lows[8], highs[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(vsum0, vsum1));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lows), vmin);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(highs), vmax);
+    for (int k = 0; k < 4; ++k)
+        sum += sums[k];
+    for (int k = 0; k < 8; ++k) {
+        low = lows[k] < low ? lows[k] : low;
+        high = highs[k] > high ? highs[k] : high;
+    }
+#elif defined(__SSE2__)
+    __m128i vsum = _mm_setzero_si128();
+    __m128i vmin = _mm_set1_epi32(INT_MAX);
+    __m128i vmax = _mm_set1_epi32(INT_MIN);
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        // SSE2 n'a pas de min/max signé sur 32 bits : sélection par masque
+        __m128i less = _mm_cmplt_epi32(v, vmin);
+        vmin = _mm_or_si128(_mm_and_si128(less, v), _mm_andnot_si128(less, vmin));
+        __m128i greater = _mm_cmpgt_epi32(v, vmax);
+        vmax = _mm_or_si128(_mm_and_si128(greater, v), _mm_andnot_si128(greater, vmax));
+        // Extension de signe à 64 bits en entrelaçant avec le bit de signe
+        __m128i sign = _mm_srai_epi32(v, 31);
+        vsum = _mm_add_epi64(vsum, _mm_unpacklo_epi32(v, sign));
+        vsum = _mm_add_epi64(vsum, _mm_unpackhi_epi32(v, sign));
+    }
+    alignas(16) long long sums[2];
+    alignas(16) int lows[4], highs[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(sums), vsum);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lows), vmin);
+    _mm_store_si128(reinterpret_cast<__m128i*>(highs), vmax);
+    sum = sums[0] + sums[1];
+    for (int k = 0; k < 4; ++k) {
+        low = lows[k] < low ? lows[k] : low;
+        high = highs[k] > high ? highs[k] : high;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        sum += values[i];
+        low = values[i] < low ? values[i] : low;
+        high = values[i] > high ? values[i] : high;
+    }
+
+    stats.sum = sum;
+    stats.min = low;
+    stats.max = high;
+    stats.mean = static_cast<double>(sum) / n;
+    return stats;
+}
+
+// Mêmes agrégats tirés des histogrammes, sur les seuls processus terminés :
+// sommes et extrêmes y sont exacts. Sert quand des processus refusés par le
+// contrôle d'admission gardent -1 dans les colonnes.
+inline ColumnStats histogramStats(const LatencyHistogram& histogram) {
+    ColumnStats stats;
+    stats.sum = histogram.sumOfValues();
+    stats.min = histogram.min();
+    stats.max = histogram.max();
+    stats.mean = histogram.mean();
+    return stats;
+}
+
+inline RunMetrics summaryMetrics(const LatencySummary& latency) {
+    RunMetrics metrics;
+    metrics.waiting = histogramStats(latency.waiting);
+    metrics.turnaround = histogramStats(latency.turnaround);
+    metrics.response = histogramStats(latency.response);
+    return metrics;
+}
+
+inline RunMetrics aggregateMetrics(const ProcessTable& processes) {
+    RunMetrics metrics;
+    metrics.waiting = columnStats(processes.waitingTime.data(), processes.size());
+    metrics.turnaround = columnStats(processes.turnaroundTime.data(), processes.size());
+    metrics.response = columnStats(processes.responseTime.data(), processes.size());
+    return metrics;
+}
@@ -0,0 +1,569 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <climits>
+#include "process.h"
+#include "indexed_heap.h"
+#include "feedback_queue.h"
+#include "ring_queue.h"
+#include "arena.h"
+
+// Files des prêts des politiques d'ordonnancement. Toutes offrent la même
+// interface, utilisée par la boucle unique Simulation::simulate<File>, qui est
+// compilée séparément pour chacune : les comparaisons et la règle de préemption
+// sont connues à la compilation et insérées dans la boucle.
+//
+//   File(processes, parameters, storage)
+//                                 construite au début de chaque exécution, ses
+//                                 tableaux pris dans l'arène de storage
+//   empty()                       plus aucun processus prêt
+//   size()                        processus dans la file (l'élu compris s'il y reste)
+//   push(i)                       arrivée du processus i, ou retour d'E/S
+//   pick(now)                     processus à exécuter, et jusqu'à quand (Slice)
+//   finish(i)                     i, choisi par pick, vient de finir sa rafale
+//                                 (terminé, ou bloqué en E/S)
+//   requeue(i, ran)               i a été interrompu après `ran` unités
+//   save(snapshot) / restore()    contenu de la file pour les points de reprise
+//   extract(running, i)           retire un processus prêt autre que `running`,
+//                                 pour le migrer vers un autre processeur
+//   insert(i)                     accueille un processus retiré d'une autre file
+//
+// Pour ajouter une politique : une file (ou un ordre pour les files à tas
+// ci-dessous), une valeur de Policy et une ligne dans policyRegistry().
+
+// Paramètres de la file multiniveau à rétroaction (MLFQ)
+struct FeedbackConfig {
+    std::vector<int> quanta; // Quantum de chaque niveau, du plus prioritaire au moins
+                             // prioritaire ; vide : 3 niveaux de quantum q, 2q et 4q
+    int boostPeriod = 100;   // Tous les processus remontent au niveau 0 à chaque
+                             // multiple de cette durée (0 : jamais)
+};
+
+struct PolicyParameters {
+    int quantum = 4;
+    FeedbackConfig feedback;
+};
+
+// Choix de pick() : le processus exécuté, la durée maximale de sa tranche, et
+// s'il doit rendre la main à la prochaine arrivée
+struct Slice {
+    std::uint32_t id;
+    int length;
+    bool interruptible;
+};
+
+// Contenu d'une file des prêts enregistré dans un point de reprise
+struct ReadySnapshot {
+    std::vector<std::uint32_t> ready; // Dans l'ordre où restore() les remet en file
+    std::vector<int> level;           // MLFQ : niveau et reste du quantum de chacun
+    std::vector<int> slice;
+    int nextBoost = 0;
+};
+
+// Tableaux indexés par processus dont les files ont besoin. Un processus n'est
+// jamais dans deux files à la fois : en multiprocesseur, les files de tous les
+// processeurs partagent ces tableaux et la mémoire ne croît pas avec le nombre
+// de processeurs. Chaque tableau n'est alloué que si une file le demande, dans
+// l'arène de l'exécution si elle est donnée : rien n'est libéré à la fin,
+// l'arène est remise à zéro d'un coup avant l'exécution suivante.
+class QueueStorage {
+private:
+    size_t count;
+    Arena* workspace;
+    ArenaVector<std::uint32_t> linkArray;
+    ArenaVector<int> sliceArray;
+    ArenaVector<std::uint32_t> epochArray;
+    ArenaVector<int> levelArray;
+
+    template <typename T>
+    T* allocate(ArenaVector<T>& array, T value) {
+        if (array.empty())
+            array.assign(count, value);
+        return array.data();
+    }
+
+public:
+    explicit QueueStorage(size_t processCount, Arena* arena = nullptr)
+        : count(processCount), workspace(arena), linkArray(ArenaAllocator<std::uint32_t>(arena)),
+          sliceArray(ArenaAllocator<int>(arena)), epochArray(ArenaAllocator<std::uint32_t>(arena)),
+          levelArray(ArenaAllocator<int>(arena)) {}
+
+    // Arène de l'exécution, pour les autres tableaux des files (nullptr : le tas)
+    Arena* arena() const {
+        return workspace;
+    }
+
+    // Position dans un tas ou suivant dans une liste, initialement absent
+    std::uint32_t* links() {
+        return allocate(linkArray, UINT32_MAX);
+    }
+
+    // MLFQ : reste du quantum, époque de ce reste et niveau d'un processus migré
+    int* slices() {
+        return allocate(sliceArray, 0);
+    }
+
+    std::uint32_t* epochs() {
+        return allocate(epochArray, std::uint32_t(0));
+    }
+
+    int* levels() {
+        return allocate(levelArray, 0);
+    }
+};
+
+// Ordres des files à tas : a passe avant b. À égalité, le premier arrivé puis
+// le premier saisi, pour que l'ordre soit total et la simulation reproductible.
+struct EarliestArrival {
+    const int* arrival;
+
+    explicit EarliestArrival(const ProcessTable& p) : arrival(p.arrivalTime.data()) {}
+
+    bool operator()(std::uint32_t a, std::uint32_t b) const {
+        if (arrival[a] == arrival[b])
+            return a < b;
+        return arrival[a] < arrival[b];
+    }
+};
+
+// Plus courte rafale d'abord. Sans préemption, un processus prêt n'a pas encore
+// entamé sa rafale : son temps restant en est la durée.
+struct ShortestBurst {
+    const int* arrival;
+    const int* burst;
+
+    explicit ShortestBurst(const ProcessTable& p) : arrival(p.arrivalTime.data()), burst(p.remainingTime.data()) {}
+
+    bool operator()(std::uint32_t a, std::uint32_t b) const {
+        if (burst[a] != burst[b])
+            return burst[a] < burst[b];
+        if (arrival[a] != arrival[b])
+            return arrival[a] < arrival[b];
+        return a < b;
+    }
+};
+
+// Plus petite valeur de priorité d'abord
+struct HighestPriority {
+    const int* arrival;
+    const int* priority;
+
+    explicit HighestPriority(const ProcessTable& p) : arrival(p.arrivalTime.data()), priority(p.priority.data()) {}
+
+    bool operator()(std::uint32_t a, std::uint32_t b) const {
+        if (priority[a] != priority[b])
+            return priority[a] < priority[b];
+        if (arrival[a] != arrival[b])
+            return arrival[a] < arrival[b];
+        return a < b;
+    }
+};
+
+// Échéance absolue la plus proche d'abord (EDF) ; les processus sans échéance
+// passent après tous les autres, par ordre d'arrivée
+struct EarliestDeadline {
+    const int* arrival;
+    const int* deadline; // nullptr si aucun processus n'a d'échéance
+
+    explicit EarliestDeadline(const ProcessTable& p)
+        : arrival(p.arrivalTime.data()), deadline(p.hasDeadlines() ? p.deadline.data() : nullptr) {}
+
+    long long due(std::uint32_t i) const {
+        return deadline == nullptr || deadline[i] < 0 ? LLONG_MAX : static_cast<long long>(arrival[i]) + deadline[i];
+    }
+
+    bool operator()(std::uint32_t a, std::uint32_t b) const {
+        long long da = due(a), db = due(b);
+        if (da != db)
+            return da < db;
+        if (arrival[a] != arrival[b])
+            return arrival[a] < arrival[b];
+        return a < b;
+    }
+};
+
+// Plus court temps restant d'abord ; la clé évolue pendant l'exécution
+struct ShortestRemaining {
+    const int* arrival;
+    const int* remaining;
+
+    explicit ShortestRemaining(const ProcessTable& p)
+        : arrival(p.arrivalTime.data()), remaining(p.remainingTime.data()) {}
+
+    bool operator()(std::uint32_t a, std::uint32_t b) const {
+        if (remaining[a] != remaining[b])
+            return remaining[a] < remaining[b];
+        if (arrival[a] != arrival[b])
+            return arrival[a] < arrival[b];
+        return a < b;
+    }
+};
+
+// Premier arrivé, premier servi : dans l'ordre d'entrée dans la file, arrivée
+// ou retour d'E/S, et jusqu'à la fin de la rafale
+class FifoQueue {
+private:
+    RingQueue queue;
+
+public:
+    FifoQueue(const ProcessTable&, const PolicyParameters&, QueueStorage& storage) : queue(storage.arena()) {}
+
+    bool empty() const {
+        return queue.empty();
+    }
+
+    size_t size() const {
+        return queue.size();
+    }
+
+    void push(std::uint32_t i) {
+        queue.push_back(i);
+    }
+
+    Slice pick(int) {
+        std::uint32_t i = queue.front();
+        queue.pop_front();
+        return {i, INT_MAX, false};
+    }
+
+    void finish(std::uint32_t) {}
+
+    void requeue(std::uint32_t i, int) {
+        queue.push_front(i);
+    }
+
+    void save(ReadySnapshot& snapshot) const {
+        queue.copyTo(snapshot.ready);
+    }
+
+    void restore(const ReadySnapshot& snapshot) {
+        queue.assign(snapshot.ready.begin(), snapshot.ready.end());
+    }
+
+    bool extract(std::uint32_t, std::uint32_t& i) {
+        if (queue.empty())
+            return false;
+        i = queue.back();
+        queue.pop_back();
+        return true;
+    }
+
+    void insert(std::uint32_t i) {
+        queue.push_back(i);
+    }
+};
+
+// Sans préemption : le meilleur processus prêt s'exécute jusqu'à la fin
+template <typename Order>
+class NonPreemptiveQueue {
+private:
+    // Les algorithmes de tas de la STL gardent le plus grand élément en tête
+    struct After {
+        Order before;
+
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            return before(b, a);
+        }
+    };
+
+    ArenaVector<std::uint32_t> heap;
+    After after;
+
+public:
+    NonPreemptiveQueue(const ProcessTable& processes, const PolicyParameters&, QueueStorage& storage)
+        : heap(ArenaAllocator<std::uint32_t>(storage.arena())), after{Order(processes)} {}
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    size_t size() const {
+        return heap.size();
+    }
+
+    void push(std::uint32_t i) {
+        heap.push_back(i);
+        std::push_heap(heap.begin(), heap.end(), after);
+    }
+
+    Slice pick(int) {
+        std::pop_heap(heap.begin(), heap.end(), after);
+        std::uint32_t i = heap.back();
+        heap.pop_back();
+        return {i, INT_MAX, false};
+    }
+
+    void finish(std::uint32_t) {}
+
+    void requeue(std::uint32_t i, int) {
+        push(i);
+    }
+
+    void save(ReadySnapshot& snapshot) const {
+        snapshot.ready.assign(heap.begin(), heap.end());
+    }
+
+    void restore(const ReadySnapshot& snapshot) {
+        heap.assign(snapshot.ready.begin(), snapshot.ready.end());
+        std::make_heap(heap.begin(), heap.end(), after);
+    }
+
+    // Le dernier élément est une feuille : le retirer préserve le tas
+    bool extract(std::uint32_t, std::uint32_t& i) {
+        if (heap.empty())
+            return false;
+        i = heap.back();
+        heap.pop_back();
+        return true;
+    }
+
+    void insert(std::uint32_t i) {
+        push(i);
+    }
+};
+
+// Avec préemption : l'élu reste dans le tas et n'est remis en cause qu'aux
+// arrivées et aux fins d'exécution. Sa clé peut baisser pendant qu'il s'exécute
+// (temps restant pour SRTF), d'où le tas adressable avec decreaseKey.
+template <typename Order>
+class PreemptiveQueue {
+private:
+    IndexedHeap<Order> heap;
+
+public:
+    PreemptiveQueue(const ProcessTable& processes, const PolicyParameters&, QueueStorage& storage)
+        : heap(storage.links(), Order(processes), storage.arena()) {}
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    size_t size() const {
+        return heap.size();
+    }
+
+    void push(std::uint32_t i) {
+        heap.push(i);
+    }
+
+    Slice pick(int) {
+        return {heap.top(), INT_MAX, true};
+    }
+
+    void finish(std::uint32_t i) {
+        heap.erase(i);
+    }
+
+    void requeue(std::uint32_t i, int) {
+        heap.decreaseKey(i);
+    }
+
+    void save(ReadySnapshot& snapshot) const {
+        snapshot.ready.assign(heap.items().begin(), heap.items().end());
+    }
+
+    void restore(const ReadySnapshot& snapshot) {
+        for (std::uint32_t i : snapshot.ready)
+            heap.push(i);
+    }
+
+    // Une feuille du tas, à défaut l'avant-dernier élément si la feuille est l'élu
+    bool extract(std::uint32_t running, std::uint32_t& i) {
+        const ArenaVector<std::uint32_t>& items = heap.items();
+        if (items.empty())
+            return false;
+        i = items.back();
+        if (i == running) {
+            if (items.size() < 2)
+                return false;
+            i = items[items.size() - 2];
+        }
+        heap.erase(i);
+        return true;
+    }
+
+    void insert(std::uint32_t i) {
+        heap.push(i);
+    }
+};
+
+// Tourniquet : tranches de `quantum`, le processus interrompu repasse en fin de file
+class RoundRobinQueue {
+private:
+    RingQueue queue;
+    int quantum;
+
+public:
+    RoundRobinQueue(const ProcessTable&, const PolicyParameters& parameters, QueueStorage& storage)
+        : queue(storage.arena()), quantum(std::max(1, parameters.quantum)) {}
+
+    bool empty() const {
+        return queue.empty();
+    }
+
+    size_t size() const {
+        return queue.size();
+    }
+
+    void push(std::uint32_t i) {
+        queue.push_back(i);
+    }
+
+    Slice pick(int) {
+        std::uint32_t i = queue.front();
+        queue.pop_front();
+        return {i, quantum, false};
+    }
+
+    void finish(std::uint32_t) {}
+
+    void requeue(std::uint32_t i, int) {
+        queue.push_back(i);
+    }
+
+    void save(ReadySnapshot& snapshot) const {
+        queue.copyTo(snapshot.ready);
+    }
+
+    void restore(const ReadySnapshot& snapshot) {
+        queue.assign(snapshot.ready.begin(), snapshot.ready.end());
+    }
+
+    // Le dernier de la file, qui aurait attendu le plus longtemps ici
+    bool extract(std::uint32_t, std::uint32_t& i) {
+        if (queue.empty())
+            return false;
+        i = queue.back();
+        queue.pop_back();
+        return true;
+    }
+
+    void insert(std::uint32_t i) {
+        queue.push_back(i);
+    }
+};
+
+// File multiniveau à rétroaction : les processus arrivent au niveau 0, et y
+// reviennent après une E/S ; celui qui épuise le quantum de son niveau descend
+// d'un niveau, et tous remontent périodiquement au niveau 0 pour éviter la
+// famine. Le niveau à servir est trouvé en O(1) dans le bitmap des files non
+// vides. Un processus de niveau inférieur est interrompu par une arrivée et
+// reprend en tête de sa file.
+//
+// Le niveau d'un processus prêt est celui de sa file, seul le reste de son
+// quantum est conservé. Après une remontée, les restes antérieurs sont périmés
+// (sliceEpoch différent de boostEpoch) : inutile de parcourir les processus.
+// Les époques sont propres à chaque file : un processus migré est recalé sur
+// celle de sa nouvelle file, en gardant son niveau et le reste de son quantum.
+class MlfqQueue {
+private:
+    FeedbackQueue queue;
+    ArenaVector<int> quanta;               // Quantum effectif de chaque niveau
+    int* sliceLeft;
+    std::uint32_t* sliceEpoch;
+    int* migratedLevel;                    // Niveau d'un processus entre extract et insert
+    std::uint32_t boostEpoch = 0;
+    int boostPeriod;
+    int nextBoost = 0;
+    int runningLevel = 0;                  // Niveau du processus choisi par pick
+
+    // Reste du quantum de `i` à son niveau ; après une remontée, le quantum du niveau 0
+    int allotment(std::uint32_t i) const {
+        return sliceEpoch[i] == boostEpoch ? sliceLeft[i] : quanta[0];
+    }
+
+public:
+    MlfqQueue(const ProcessTable&, const PolicyParameters& parameters, QueueStorage& storage)
+        : queue(storage.links()),
+          quanta(parameters.feedback.quanta.begin(), parameters.feedback.quanta.end(),
+                 ArenaAllocator<int>(storage.arena())),
+          sliceLeft(storage.slices()), sliceEpoch(storage.epochs()), migratedLevel(storage.levels()),
+          boostPeriod(parameters.feedback.boostPeriod) {
+        if (quanta.empty()) {
+            int base = std::max(1, parameters.quantum);
+            quanta = {base, 2 * base, 4 * base};
+        }
+        if (quanta.size() > static_cast<size_t>(FeedbackQueue::maxLevels))
+            quanta.resize(FeedbackQueue::maxLevels);
+        for (int& q : quanta)
+            q = std::max(1, q);
+    }
+
+    bool empty() const {
+        return queue.empty();
+    }
+
+    size_t size() const {
+        return queue.size();
+    }
+
+    void push(std::uint32_t i) {
+        sliceLeft[i] = quanta[0];
+        sliceEpoch[i] = boostEpoch;
+        queue.pushBack(0, i);
+    }
+
+    Slice pick(int now) {
+        if (boostPeriod > 0 && now >= nextBoost) {
+            queue.boost();
+            boostEpoch++;
+            nextBoost = (now / boostPeriod + 1) * boostPeriod;
+        }
+        runningLevel = queue.highest();
+        std::uint32_t i = queue.front(runningLevel);
+        queue.popFront(runningLevel);
+        sliceLeft[i] = allotment(i);
+        sliceEpoch[i] = boostEpoch;
+        return {i, sliceLeft[i], runningLevel > 0};
+    }
+
+    void finish(std::uint32_t) {}
+
+    void requeue(std::uint32_t i, int ran) {
+        sliceLeft[i] -= ran;
+        if (sliceLeft[i] > 0) {
+            queue.pushFront(runningLevel, i);
+            return;
+        }
+        int lower = std::min(runningLevel + 1, static_cast<int>(quanta.size()) - 1);
+        sliceLeft[i] = quanta[lower];
+        queue.pushBack(lower, i);
+    }
+
+    void save(ReadySnapshot& snapshot) const {
+        queue.items(snapshot.ready, snapshot.level);
+        snapshot.slice.clear();
+        for (std::uint32_t i : snapshot.ready)
+            snapshot.slice.push_back(allotment(i));
+        snapshot.nextBoost = nextBoost;
+    }
+
+    void restore(const ReadySnapshot& snapshot) {
+        for (size_t k = 0; k < snapshot.ready.size(); ++k) {
+            std::uint32_t i = snapshot.ready[k];
+            sliceLeft[i] = snapshot.slice[k];
+            sliceEpoch[i] = boostEpoch;
+            queue.pushBack(snapshot.level[k], i);
+        }
+        nextBoost = snapshot.nextBoost;
+    }
+
+    // Le premier du niveau le moins prioritaire
+    bool extract(std::uint32_t, std::uint32_t& i) {
+        if (queue.empty())
+            return false;
+        int level = queue.lowest();
+        i = queue.front(level);
+        queue.popFront(level);
+        sliceLeft[i] = allotment(i);
+        migratedLevel[i] = level;
+        return true;
+    }
+
+    void insert(std::uint32_t i) {
+        sliceEpoch[i] = boostEpoch;
+        queue.pushBack(migratedLevel[i], i);
+    }
+};
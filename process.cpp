@@ -1,347 +1,632 @@
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <algorithm>
 #include <string>
 #include <sstream> // Pour std::stringstream
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <memory>
 #include <gtk/gtk.h> //
-
-// Classe représentant un processus
-class Process {
-public:
-    int pid;
-    std::string name;
-    int arrivalTime;
-    int burstTime;
-    int priority;
-    int remainingTime;
-    int waitingTime;
-    int turnaroundTime;
-    int responseTime; // Ajout du temps de réponse
-
-    Process(int p, std::string n, int at, int bt, int pr = 0)
-        : pid(p), name(n), arrivalTime(at), burstTime(bt),
-          priority(pr), remainingTime(bt), waitingTime(0),
-          turnaroundTime(0), responseTime(-1) {} // Initialisation à -1 (non défini)
-};
+#include "process.h"
+#include "simulation.h"
+#include "timeline.h"
+#include "sweep.h"
+#include "metrics.h"
+#include "histogram.h"
+#include "gantt.h"
+#include "instrumentation.h"
 
 // Classe de gestion de l'ordonnancement
 class Scheduler {
 private:
-    std::vector<Process> processes;
+    // Table simulée, et celle où chaque clic lit les champs avant de la comparer
+    // à la précédente. Les deux sont échangées au lieu d'être recopiées, et
+    // vidées sans rendre leur mémoire : d'un clic à l'autre, rien n'est réalloué.
+    ProcessTable processes;
+    ProcessTable input;
 
     // Widgets GTK pour les champs d'entrée
     GtkWidget *entryProcesses;
     GtkWidget *entryArrivals;
     GtkWidget *entryDurations;
     GtkWidget *entryPriorities;
-
-    // Boutons radio pour sélectionner le type d'algorithme
-    GtkWidget *fifoRadio;
-    GtkWidget *priorityRadio;
-    GtkWidget *roundRobinRadio;
-    GtkWidget *sjfRadio; // Ajout du bouton radio pour SJF
-
-    // Zone de dessin pour la grille
+    GtkWidget *entryQuantum;
+    GtkWidget *entryCpus;
+    GtkWidget *entryDeadlines;
+    GtkWidget *checkAdmission;
+
+    // Boutons radio pour sélectionner le type d'algorithme, un par entrée de policyRegistry()
+    std::vector<GtkWidget*> policyRadios;
+
+    // Boutons d'action et suivi de la simulation
+    GtkWidget *btnSchedule;
+    GtkWidget *btnReset; // Sert aussi à annuler une simulation en cours
+    GtkWidget *progressBar;
+
+    // Simulation en arrière-plan : la boucle GTK reste réactive et interroge
+    // l'avancement périodiquement, les segments sont dessinés au fil de l'eau
+    std::thread worker;
+    SimulationControl control;
+    std::atomic<bool> workerDone{false};
+    bool running = false;
+    guint pollSource = 0;
+
+    // Simulation conservée d'un clic à l'autre avec ses points de reprise :
+    // si seules quelques valeurs changent, on ne resimule que la fin
+    std::unique_ptr<Simulation> simulation;
+    Policy simulatedPolicy = Policy::FCFS;
+    std::string simulatedQuantum;
+    std::string simulatedCpus;
+    bool simulatedAdmission = false;
+    bool resuming = false;
+
+    // Durée des phases et compteurs de l'ordonnanceur depuis le dernier clic,
+    // relevés seulement avec SCHEDULER_INSTRUMENTATION (instrumentation.h)
+    Profile profile;
+
+    // Zone de dessin pour la grille et ses barres de défilement
     GtkWidget *drawingArea;
+    GtkAdjustment *hAdjustment;
+    GtkAdjustment *vAdjustment;
+
+    // Dimensions de la grille, celles du diagramme (gantt.h)
+    static constexpr int cellWidth = GanttChart::cellWidth;
+    static constexpr int rowHeight = GanttChart::rowHeight;
+    static constexpr int xOffset = GanttChart::xOffset;
+    static constexpr int yOffset = GanttChart::yOffset;
+
+    // Chronologie produite par la dernière simulation ; en multiprocesseur,
+    // une par processeur, dessinées chacune sur sa rangée. Les chronologies des
+    // processeurs sont gardées avec leurs blocs d'une simulation à l'autre, seules
+    // les premières servent quand il y a moins de processeurs.
+    Timeline timeline;
+    std::vector<std::unique_ptr<Timeline>> lanes;
+    Timeline blocked;   // Attentes d'E/S, sur la rangée de chaque processus
+    int longestIo = 0;  // Plus longue attente d'E/S : les segments de `blocked` sont ordonnés par fin
+    double zoom = 1.0; // Facteur appliqué à la largeur des cellules
+
+    // Calque statique (grille et libellés) rendu hors écran avec une marge
+    // autour de la vue, et réutilisé tant que la mise en page ne change pas et
+    // que le défilement reste dans la marge
+    cairo_surface_t *gridCache = nullptr;
+    GanttView cachedView = {};  // Vue qui a produit le calque, clé du cache
+    GanttView cachedArea = {};  // Portion du diagramme couverte par le calque
+    static constexpr int cacheMargin = 512; // Marge maximale de chaque côté, en pixels
 
     // Variables pour stocker les valeurs récupérées
     int numProcesses;
     std::string arrivalTimes;
     std::string burstTimes;
     std::string priorities;
-    std::string selectedAlgorithm;
+    std::string quantumText;
+    std::string cpusText;
+    std::string deadlinesText;
+    bool admission = false;
+    int autoQuantum = 0; // Quantum choisi par le thread de calcul, 0 s'il était saisi
+    Policy selectedPolicy = Policy::FCFS;
     std::string algorithm;
 
 public:
-    void addProcess(Process p) {
-        processes.push_back(p);
+    ~Scheduler() {
+        if (worker.joinable()) {
+            control.cancelled = true;
+            worker.join();
+        }
+        if (pollSource != 0)
+            g_source_remove(pollSource);
+        if (gridCache != nullptr)
+            cairo_surface_destroy(gridCache);
     }
 
-    void calculateWaitingAndTurnaround(Process& process, int startTime, int endTime) {
-        process.waitingTime = startTime - process.arrivalTime;
-        process.turnaroundTime = endTime - process.arrivalTime;
+    void addProcess(int pid, int arrivalTime, int burstTime, int priority) {
+        processes.add(pid, arrivalTime, burstTime, priority);
     }
 
     int getLastProcessId() const {
         if (processes.empty()) {
             return 0; // Retourne 0 si la liste est vide
         }
-        return processes.back().pid; // Retourne l'ID du dernier processus
+        return processes.pid.back(); // Retourne l'ID du dernier processus
     }
 
-    // Méthode pour vider le vecteur de processus
+    // Méthode pour vider la table des processus ; les colonnes gardent leur
+    // capacité pour la simulation suivante
     void clearProcesses() {
-        processes.clear(); // Vider le vecteur
-        processes.shrink_to_fit(); // Optionnel : libérer la mémoire
+        processes.clear();
+        input.clear();
     }
 
-    // Méthode FCFS (First Come First Served)
-    void FCFS() {
-        std::sort(processes.begin(), processes.end(),
-            [](const Process& a, const Process& b) {
-                return a.arrivalTime < b.arrivalTime;
-            });
+    void displayResults() {
+        if (autoQuantum > 0)
+            std::cout << "Quantum choisi automatiquement : " << autoQuantum << "\n";
+        std::cout << "PID\tName\t\tArrival\t\tBurst\t\tPriority\t\tWaiting\t\tTurnaround\tResponse\n";
+        for (size_t i = 0; i < processes.size(); ++i) {
+            std::cout << processes.pid[i] << "\t" << processes.name(i) << "\t\t" << processes.arrivalTime[i] << "\t\t"
+                      << processes.burstTime[i] << "\t\t" << processes.priority[i] << "\t\t"
+                      << processes.waitingTime[i] << "\t\t" << processes.turnaroundTime[i] << "\t\t"
+                      << processes.responseTime[i] << "\n";
+        }
 
-        int currentTime = 0;
-        for (auto& process : processes) {
-            if (currentTime < process.arrivalTime)
-                currentTime = process.arrivalTime;
+        // Moyennes et extrêmes, calculés sur les colonnes de la table ; sur les
+        // histogrammes s'il y a des refusés, qui ne comptent pas
+        const DeadlineSummary& deadlines = simulation->deadlines();
+        RunMetrics metrics;
+        {
+            ScopedPhase aggregating(&profile, "aggregate");
+            metrics = deadlines.rejected > 0 ? summaryMetrics(simulation->latencies()) : aggregateMetrics(processes);
+        }
+        std::cout << "Moyennes\t\t\t\t\t\t\t\t" << metrics.waiting.mean << "\t\t"
+                  << metrics.turnaround.mean << "\t\t" << metrics.response.mean << "\n";
+        std::cout << "Maximums\t\t\t\t\t\t\t\t" << metrics.waiting.max << "\t\t"
+                  << metrics.turnaround.max << "\t\t" << metrics.response.max << "\n";
+
+        // Centiles des histogrammes remplis pendant la simulation
+        const LatencySummary& latency = simulation->latencies();
+        const std::pair<const char*, double> percentiles[] = {
+            {"p50", 0.5}, {"p95", 0.95}, {"p99", 0.99}, {"p99.9", 0.999}};
+        for (const auto& [label, fraction] : percentiles)
+            std::cout << label << "\t\t\t\t\t\t\t\t\t" << latency.waiting.percentile(fraction) << "\t\t"
+                      << latency.turnaround.percentile(fraction) << "\t\t"
+                      << latency.response.percentile(fraction) << "\n";
+
+        if (processes.hasIo())
+            std::cout << "E/S : total " << columnStats(processes.ioTime.data(), processes.size()).sum << "\n";
+
+        if (processes.hasDeadlines()) {
+            std::cout << "Échéances : " << deadlines.count() - deadlines.missed << " tenues, " << deadlines.missed
+                      << " manquées, " << deadlines.rejected << " refusées\n";
+            if (deadlines.count() > 0)
+                std::cout << "Retard : moyenne " << deadlines.meanLateness() << ", min " << deadlines.minLateness
+                          << ", max " << deadlines.maxLateness << ", p99 " << deadlines.tardiness.percentile(0.99)
+                          << "\n";
+        }
 
-            int startTime = currentTime;
-            currentTime += process.burstTime;
-            calculateWaitingAndTurnaround(process, startTime, currentTime);
+        // Utilisation de chaque processeur ; avec un seul, seulement si les E/S le laissent inactif
+        const std::vector<ProcessorStats>& cpus = simulation->processors();
+        if (cpus.size() > 1 || processes.hasIo()) {
+            int end = std::max(1, simulation->endTime());
+            std::cout << "CPU\tUtilisation\tMigrations reçues\tCédées\n";
+            for (size_t c = 0; c < cpus.size(); ++c)
+                std::cout << c << "\t" << 100.0 * cpus[c].busy / end << " %\t\t" << cpus[c].migratedIn
+                          << "\t\t\t" << cpus[c].migratedOut << "\n";
         }
     }
 
-    void RoundRobin(int quantum) {
-        std::queue<Process*> readyQueue;
-        int currentTime = 0;
-        size_t i = 0;
-
-        // Trier les processus par temps d'arrivée
-        std::sort(processes.begin(), processes.end(),
-                [](const Process& a, const Process& b) {
-                    return a.arrivalTime < b.arrivalTime;
-                });
+    void getInputValues() {
+        const char *processesText = gtk_entry_get_text(GTK_ENTRY(entryProcesses));
+        const char *arrivalsText = gtk_entry_get_text(GTK_ENTRY(entryArrivals));
+        const char *durationsText = gtk_entry_get_text(GTK_ENTRY(entryDurations));
+        const char *prioritiesText = gtk_entry_get_text(GTK_ENTRY(entryPriorities));
+        quantumText = gtk_entry_get_text(GTK_ENTRY(entryQuantum));
+        cpusText = gtk_entry_get_text(GTK_ENTRY(entryCpus));
+        deadlinesText = gtk_entry_get_text(GTK_ENTRY(entryDeadlines));
+        admission = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(checkAdmission));
 
-        // Initialisation du tableau pour les temps de réponse
-        std::vector<bool> firstResponse(processes.size(), true);
+        numProcesses = atoi(processesText);
+        arrivalTimes = arrivalsText;
+        burstTimes = durationsText;
+        priorities = prioritiesText;
 
-        while (i < processes.size() || !readyQueue.empty()) {
-            // Ajouter les processus arrivés au temps actuel dans la file d'attente
-            while (i < processes.size() && processes[i].arrivalTime <= currentTime) {
-                readyQueue.push(&processes[i]);
-                i++;
-            }
+        for (size_t k = 0; k < policyRadios.size(); ++k) {
+            if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(policyRadios[k])))
+                selectedPolicy = policyRegistry()[k].policy;
+        }
+    }
 
-            if (!readyQueue.empty()) {
-                // Obtenir le processus en tête de file
-                Process* currentProcess = readyQueue.front();
-                readyQueue.pop();
+    void showAlertWithValues() {
+        getInputValues();  // Récupérer les valeurs des champs d'entrée
+        profile.clear();
 
-                // Enregistrer le temps de réponse si c'est la première exécution
-                if (firstResponse[currentProcess->pid - 1]) {
-                    currentProcess->responseTime = currentTime - currentProcess->arrivalTime;
-                    firstResponse[currentProcess->pid - 1] = false;
+        std::stringstream arrivalStream(arrivalTimes);
+        std::stringstream burstStream(burstTimes);
+        std::stringstream priorityStream(priorities);
+        std::string arrival, burst, priority, phase;
+
+        // Lecture dans une table à part, comparée ensuite à la précédente ;
+        // les pids commencent à 1. Une durée "9/3/2" alterne calcul et E/S.
+        input.clear();
+        int count = 1;
+        std::vector<int> bursts;
+
+        {
+            ScopedPhase parsing(&profile, "parse");
+            while (std::getline(arrivalStream, arrival, ',') &&
+                   std::getline(burstStream, burst, ',') &&
+                   std::getline(priorityStream, priority, ',')) {
+                std::stringstream phaseStream(burst);
+                bursts.clear();
+                while (std::getline(phaseStream, phase, '/'))
+                    bursts.push_back(std::stoi(phase));
+                // L'horloge de la simulation part de 0 : une arrivée antérieure
+                // compterait une attente qui n'a pas eu lieu
+                if (std::stoi(arrival) < 0) {
+                    std::cout << "Arrivée invalide pour le processus " << count << " : " << arrival << "\n";
+                    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "Arrivée invalide");
+                    return;
                 }
+                input.addBursts(count, std::stoi(arrival), bursts, std::stoi(priority));
+                count++;
+            }
 
-                // Exécuter le processus pendant un quantum ou jusqu'à sa fin
-                int executionTime = std::min(quantum, currentProcess->remainingTime);
-                currentTime += executionTime;
-                currentProcess->remainingTime -= executionTime;
-
-                // Ajouter les processus nouvellement arrivés pendant cette exécution
-                while (i < processes.size() && processes[i].arrivalTime <= currentTime) {
-                    readyQueue.push(&processes[i]);
-                    i++;
-                }
+            // Échéances "10,0,25:40" : échéance relative à l'arrivée, et période
+            // après ":" ; vide ou 0 : aucune
+            std::stringstream deadlineStream(deadlinesText);
+            std::string deadline;
+            for (size_t i = 0; i < input.size() && std::getline(deadlineStream, deadline, ','); ++i) {
+                size_t colon = deadline.find(':');
+                int relative = atoi(deadline.substr(0, colon).c_str());
+                int period = colon == std::string::npos ? 0 : atoi(deadline.c_str() + colon + 1);
+                if (relative > 0)
+                    input.setDeadline(i, relative, std::max(0, period));
+            }
+        }
+        std::cout << policyInfo(selectedPolicy).label << "\n";
+        // Process::algorithm = selectedAlgorithm;
 
-                // Si le processus n'est pas terminé, le remettre dans la file d'attente
-                if (currentProcess->remainingTime > 0) {
-                    readyQueue.push(currentProcess);
-                } else {
-                    // Si le processus est terminé, calculer les temps d'attente et de retour
-                    calculateWaitingAndTurnaround(*currentProcess,
-                                                currentTime - currentProcess->burstTime,
-                                                currentTime);
-                }
+        resuming = prepareResume(input);
+        if (resuming) {
+            std::cout << "Reprise de la simulation précédente\n";
+        } else {
+            // La simulation précédente est gardée avec sa mémoire de travail
+            std::swap(processes, input);
+            if (simulation == nullptr) {
+                simulation = std::make_unique<Simulation>(processes, &timeline, &control, &profile);
+                simulation->recordBlocked(&blocked);
+                simulation->enableCheckpoints();
             } else {
-                // Si la file d'attente est vide, avancer le temps
-                currentTime++;
+                simulation->reload();
             }
+            simulation->enableAdmission(admission);
+            simulatedAdmission = admission;
+            longestIo = longestIoBurst(processes);
+            configureProcessors();
+            simulatedPolicy = selectedPolicy;
+            simulatedQuantum = quantumText;
+            simulatedCpus = cpusText;
+            timeline.clear();
+            blocked.clear();
         }
+
+        // La simulation part dans un thread de calcul ; le résultat est récupéré
+        // par onSimulationProgress quand workerDone passe à vrai
+        control.completed = 0;
+        control.cancelled = false;
+        autoQuantum = 0;
+        workerDone = false;
+        running = true;
+        gtk_widget_set_sensitive(btnSchedule, FALSE);
+        gtk_button_set_label(GTK_BUTTON(btnReset), "Annuler");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progressBar), 0.0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "Simulation en cours");
+        updateScrollRange();
+
+        worker = std::thread([this]() {
+            if (resuming)
+                simulation->resume();
+            else
+                runSelectedAlgorithm();
+            workerDone.store(true, std::memory_order_release);
+        });
+        pollSource = g_timeout_add(50, onSimulationProgress, this);
     }
 
-    void PriorityScheduling() {
-        // Trier les processus par priorité en premier
-        // Si deux processus ont la même priorité, comparer par temps d'arrivée
-        std::sort(processes.begin(), processes.end(),
-                    [](const Process& a, const Process& b) {
-                        if (a.priority == b.priority) {
-                            return a.arrivalTime < b.arrivalTime; // Comparer par temps d'arrivée
-                        }
-                        return a.priority < b.priority; // Comparer par priorité
-                    });
+    // Processeurs "N" ou "N,P" (équilibrage toutes les P unités) ; vide : un seul
+    ProcessorConfig processorConfig() const {
+        ProcessorConfig config;
+        std::stringstream cpusStream(cpusText);
+        std::string value;
+        if (std::getline(cpusStream, value, ','))
+            config.cpus = std::max(1, atoi(value.c_str()));
+        if (std::getline(cpusStream, value, ','))
+            config.balancePeriod = std::max(0, atoi(value.c_str()));
+        return config;
+    }
 
-        int currentTime = 0;
+    void configureProcessors() {
+        ProcessorConfig config = processorConfig();
+        std::vector<Timeline*> cpuLanes;
+        if (config.cpus > 1) {
+            while (lanes.size() < static_cast<size_t>(config.cpus))
+                lanes.push_back(std::make_unique<Timeline>());
+            for (int c = 0; c < config.cpus; ++c)
+                cpuLanes.push_back(lanes[c].get());
+        }
+        simulation->configureProcessors(config, cpuLanes);
+    }
 
-        for (auto& process : processes) {
-            if (currentTime < process.arrivalTime)
-                currentTime = process.arrivalTime;
+    // Même algorithme, même quantum et même nombre de processus que la
+    // simulation précédente : reporte les valeurs modifiées dans la table et
+    // revient au dernier point de reprise qui les précède. Appelé avant le
+    // lancement du thread de calcul, car la chronologie est tronquée. Avec des
+    // E/S, il n'y a pas de point de reprise : tout est resimulé.
+    bool prepareResume(const ProcessTable& input) {
+        if (simulation == nullptr || selectedPolicy != simulatedPolicy ||
+            quantumText != simulatedQuantum || cpusText != simulatedCpus || admission != simulatedAdmission ||
+            input.size() != processes.size() || input.hasIo() || processes.hasIo() ||
+            input.deadline != processes.deadline || input.period != processes.period)
+            return false;
+        // Quantum automatique : il peut changer avec les données
+        if (selectedPolicy == Policy::RoundRobin && atoi(quantumText.c_str()) <= 0)
+            return false;
+
+        std::vector<std::uint32_t> edited;
+        std::vector<int> oldArrivals;
+        for (size_t i = 0; i < input.size(); ++i) {
+            if (input.arrivalTime[i] == processes.arrivalTime[i] &&
+                input.burstTime[i] == processes.burstTime[i] &&
+                input.priority[i] == processes.priority[i])
+                continue;
+            edited.push_back(static_cast<std::uint32_t>(i));
+            oldArrivals.push_back(processes.arrivalTime[i]);
+            processes.arrivalTime[i] = input.arrivalTime[i];
+            processes.burstTime[i] = input.burstTime[i];
+            processes.priority[i] = input.priority[i];
+        }
+        return simulation->rewind(edited, oldArrivals);
+    }
 
-            int startTime = currentTime;
-            currentTime += process.burstTime;
-            calculateWaitingAndTurnaround(process, startTime, currentTime);
+    // Exécuté dans le thread de calcul
+    void runSelectedAlgorithm() {
+        int quantum = atoi(quantumText.c_str());
+        if (selectedPolicy == Policy::RoundRobin && quantum <= 0) {
+            // Pas de quantum saisi : celui qui minimise l'attente moyenne sur
+            // les mêmes processeurs, affiché avec les résultats
+            quantum = autotuneQuantum(processes, processorConfig(), Objective::MeanWaiting, 0, &control);
+            if (quantum == 0)
+                return; // Annulé pendant la recherche
+            autoQuantum = quantum;
         }
+        if (selectedPolicy == Policy::MLFQ) {
+            // Quanta des niveaux séparés par des virgules, du plus prioritaire au
+            // moins prioritaire ; vide : 4, 8 et 16. Après ";", la période de
+            // remontée au niveau 0 (0 : jamais), comme --boost de batch
+            FeedbackConfig config;
+            size_t semicolon = quantumText.find(';');
+            std::stringstream quantumStream(quantumText.substr(0, semicolon));
+            std::string level;
+            while (std::getline(quantumStream, level, ','))
+                if (atoi(level.c_str()) > 0)
+                    config.quanta.push_back(atoi(level.c_str()));
+            if (semicolon != std::string::npos)
+                config.boostPeriod = std::max(0, atoi(quantumText.c_str() + semicolon + 1));
+            simulation->configureFeedback(config);
+        }
+        simulation->run(selectedPolicy, quantum > 0 ? quantum : 4);
     }
 
-    void SJF() {
-        // Trier les processus par temps d'exécution croissant
-        // Si deux processus ont le même temps d'exécution, trier par temps d'arrivée
-        std::sort(processes.begin(), processes.end(),
-                  [](const Process& a, const Process& b) {
-                      if (a.burstTime == b.burstTime) {
-                          return a.arrivalTime < b.arrivalTime; // Comparer par temps d'arrivée
-                      }
-                      return a.burstTime < b.burstTime; // Comparer par temps d'exécution
-                  });
+    // Retour dans la boucle GTK une fois le thread de calcul terminé
+    void finishScheduling() {
+        worker.join();
+        running = false;
+        gtk_widget_set_sensitive(btnSchedule, TRUE);
+        gtk_button_set_label(GTK_BUTTON(btnReset), "Réinitialiser");
 
-        int currentTime = 0;
+        if (control.cancelled) {
+            gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "Simulation annulée");
+        } else {
+            gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progressBar), 1.0);
+            gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "Simulation terminée");
+            displayResults();
+            reportProfile();
+        }
 
-        for (auto& process : processes) {
-            if (currentTime < process.arrivalTime) {
-                currentTime = process.arrivalTime;
-            }
+        updateScrollRange();
+        drawGrid(); // Appel pour dessiner la grille après l'ordonnancement
+    }
 
-            int startTime = currentTime;
-            currentTime += process.burstTime;
-            calculateWaitingAndTurnaround(process, startTime, currentTime);
+    // Relevés de l'instrumentation, affichés avec les résultats et exportés dans
+    // le dossier courant : profil.json et profil-trace.json (chrome://tracing)
+    void reportProfile() {
+        if constexpr (!instrumented)
+            return;
+        profile.print(std::cout);
+        try {
+            profile.writeJson("profil.json");
+            profile.writeChromeTrace("profil-trace.json");
+        } catch (const std::exception& e) {
+            std::cout << e.what() << "\n";
         }
     }
 
-    void displayResults() {
-        std::cout << "PID\tName\t\tArrival\t\tBurst\t\tPriority\t\tWaiting\t\tTurnaround\tResponse\n";
-        for (const auto& process : processes) {
-            std::cout << process.pid << "\t" << process.name << "\t\t" << process.arrivalTime << "\t\t"
-                      << process.burstTime << "\t\t" << process.priority << "\t\t"
-                      << process.waitingTime << "\t\t" << process.turnaroundTime << "\t\t"
-                      << process.responseTime << "\n";
+    // Appelé toutes les 50 ms pendant la simulation : avancement et dessin partiel
+    static gboolean onSimulationProgress(gpointer data) {
+        Scheduler *scheduler = static_cast<Scheduler*>(data);
+        size_t total = scheduler->processes.size();
+        size_t done = scheduler->control.completed.load(std::memory_order_relaxed);
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(scheduler->progressBar),
+                                      total == 0 ? 1.0 : static_cast<double>(done) / total);
+        scheduler->updateScrollRange();
+        scheduler->drawGrid();
+
+        if (!scheduler->workerDone.load(std::memory_order_acquire))
+            return G_SOURCE_CONTINUE;
+        scheduler->pollSource = 0;
+        scheduler->finishScheduling();
+        return G_SOURCE_REMOVE;
+    }
+
+    // Annule la simulation en cours, sinon vide les champs et le diagramme
+    void reset() {
+        if (running) {
+            control.cancelled = true;
+            gtk_button_set_label(GTK_BUTTON(btnReset), "Annulation...");
+            return;
         }
+        gtk_entry_set_text(GTK_ENTRY(entryProcesses), "");
+        gtk_entry_set_text(GTK_ENTRY(entryArrivals), "");
+        gtk_entry_set_text(GTK_ENTRY(entryDurations), "");
+        gtk_entry_set_text(GTK_ENTRY(entryPriorities), "");
+        gtk_entry_set_text(GTK_ENTRY(entryQuantum), "");
+        gtk_entry_set_text(GTK_ENTRY(entryCpus), "");
+        gtk_entry_set_text(GTK_ENTRY(entryDeadlines), "");
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(checkAdmission), FALSE);
+        simulation.reset();
+        clearProcesses();
+        timeline.clear();
+        blocked.clear();
+        longestIo = 0;
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progressBar), 0.0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "");
+        updateScrollRange();
+        drawGrid();
     }
 
-    void getInputValues() {
-        const char *processesText = gtk_entry_get_text(GTK_ENTRY(entryProcesses));
-        const char *arrivalsText = gtk_entry_get_text(GTK_ENTRY(entryArrivals));
-        const char *durationsText = gtk_entry_get_text(GTK_ENTRY(entryDurations));
-        const char *prioritiesText = gtk_entry_get_text(GTK_ENTRY(entryPriorities));
+    void drawGrid() {
+        gtk_widget_queue_draw(drawingArea); // Demande de redessiner la zone de dessin
+    }
 
-        numProcesses = atoi(processesText);
-        arrivalTimes = arrivalsText;
-        burstTimes = durationsText;
-        priorities = prioritiesText;
+    double cellSize() const {
+        return cellWidth * zoom;
+    }
 
-        if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(fifoRadio))) {
-            selectedAlgorithm = "FIFO";
-        } else if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(priorityRadio))) {
-            selectedAlgorithm = "Priorité avec préemption";
-        } else if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(roundRobinRadio))) {
-            selectedAlgorithm = "Tourniquet";
-        } else if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(sjfRadio))) {
-            selectedAlgorithm = "SJF";
+    // Diagramme des chronologies courantes, lues pendant que la simulation les remplit
+    GanttChart chart() const {
+        if (simulation == nullptr) {
+            GanttChart gantt;
+            gantt.processes = &processes;
+            return gantt;
         }
+        return GanttChart(simulation->schedule(), longestIo);
     }
 
-    void showAlertWithValues() {
-        getInputValues();  // Récupérer les valeurs des champs d'entrée
+    // Une rangée par processus, ou par processeur en multiprocesseur
+    size_t chartRows() const {
+        return chart().rows();
+    }
 
-        std::stringstream arrivalStream(arrivalTimes);
-        std::stringstream burstStream(burstTimes);
-        std::stringstream priorityStream(priorities);
-        std::string arrival, burst, priority;
+    int chartEndTime() const {
+        return chart().endTime();
+    }
 
-        int count = getLastProcessId() + 1;
+    double contentWidth() const {
+        return 2 * xOffset + chartEndTime() * cellSize();
+    }
 
-        while (std::getline(arrivalStream, arrival, ',') &&
-               std::getline(burstStream, burst, ',') &&
-               std::getline(priorityStream, priority, ',')) {
-            addProcess(Process(count++, "Processus " + std::to_string(count),
-                               std::stoi(arrival), std::stoi(burst), std::stoi(priority)));
-        }
-        std::cout << selectedAlgorithm << "\n";
-        // Process::algorithm = selectedAlgorithm;
+    double contentHeight() const {
+        return yOffset + (chartRows() + 1) * rowHeight;
+    }
 
-        if (selectedAlgorithm == "FIFO") {
-            FCFS();
-        } else if (selectedAlgorithm == "Tourniquet") {
-            RoundRobin(4);
-        } else if (selectedAlgorithm == "SJF") {
-            SJF();
-        } else {
-            PriorityScheduling();
-        }
+    // Ajuste les barres de défilement à la taille du diagramme. Le défilement est
+    // virtuel : la zone de dessin garde la taille de la fenêtre, quelle que soit
+    // la longueur de l'ordonnancement.
+    void updateScrollRange() {
+        double width = gtk_widget_get_allocated_width(drawingArea);
+        double height = gtk_widget_get_allocated_height(drawingArea);
+        double upperX = std::max(contentWidth(), width);
+        double upperY = std::max(contentHeight(), height);
+        gtk_adjustment_configure(hAdjustment,
+                                 std::min(gtk_adjustment_get_value(hAdjustment), upperX - width),
+                                 0, upperX, width * 0.1, width * 0.9, width);
+        gtk_adjustment_configure(vAdjustment,
+                                 std::min(gtk_adjustment_get_value(vAdjustment), upperY - height),
+                                 0, upperY, rowHeight, height * 0.9, height);
+    }
 
-        displayResults();
+    // Zoom horizontal en gardant fixe l'instant situé sous `anchorX`
+    void zoomAt(double factor, double anchorX) {
+        double width = gtk_widget_get_allocated_width(drawingArea);
+        double x = gtk_adjustment_get_value(hAdjustment);
+        double time = (x + anchorX - xOffset) / cellSize();
 
-        drawGrid(); // Appel pour dessiner la grille après l'ordonnancement
+        // Au plus petit zoom, tout l'ordonnancement tient dans la fenêtre
+        double minZoom = std::min(1.0, std::max(width - 2 * xOffset, 1.0) / (cellWidth * std::max(chartEndTime(), 1)));
+        zoom = std::min(4.0, std::max(minZoom, zoom * factor));
+
+        updateScrollRange();
+        gtk_adjustment_set_value(hAdjustment, xOffset + time * cellSize() - anchorX);
+        drawGrid();
     }
 
-    void drawGrid() {
-        gtk_widget_queue_draw(drawingArea); // Demande de redessiner la zone de dessin
+    GanttView currentView() const {
+        // Position arrondie au pixel : le calque en cache est recopié sans flou
+        return {std::round(gtk_adjustment_get_value(hAdjustment)), std::round(gtk_adjustment_get_value(vAdjustment)),
+                gtk_widget_get_allocated_width(drawingArea), gtk_widget_get_allocated_height(drawingArea),
+                cellSize(), static_cast<double>(rowHeight), chartRows(), chartEndTime()};
     }
 
     static gboolean on_draw(GtkWidget *widget, cairo_t *cr, gpointer data) {
         Scheduler *scheduler = static_cast<Scheduler*>(data);
-
-        // Dimensions de la grille
-        const int cellWidth = 30;  // Largeur de chaque cellule
-        const int rowHeight = 20;  // Hauteur de chaque rangée
-        const int xOffset = 70;    // Décalage horizontal (pour les temps)
-        const int yOffset = 50;    // Décalage vertical (pour commencer à dessiner)
-        const int quantum = 4;    // Quantum de 4 unités de temps
-
-        // Tableau de couleurs pour chaque processus
-        std::vector<std::tuple<double, double, double>> colors = {
-            {0.0, 0.0, 1.0}, // Bleu
-        };
-
-        // Dessiner les en-têtes des temps
-        cairo_set_source_rgb(cr, 0, 0, 0); // Texte en noir
-        for (int t = 0; t <= 50; ++t) {  // Ajustez 50 en fonction de la durée maximale
-            std::string timeLabel = std::to_string(t);
-            cairo_move_to(cr, xOffset + t * cellWidth + cellWidth / 4, yOffset - 10);
-            cairo_show_text(cr, timeLabel.c_str());
+        GanttView view = scheduler->currentView();
+        if (view.width <= 0 || view.height <= 0)
+            return FALSE;
+        ScopedPhase rendering(&scheduler->profile, "render");
+        GanttChart gantt = scheduler->chart();
+
+        // Barres de progression, seules redessinées à chaque exposition
+        gantt.renderSegments(cr, view);
+
+        // Calque statique : rendu hors écran quand la mise en page change ou que
+        // la vue sort de la marge, sinon recopié décalé de la position de défilement
+        if (scheduler->gridCache == nullptr || !scheduler->cachedView.sameLayout(view) ||
+            !scheduler->cachedArea.contains(view)) {
+            GanttView area = view;
+            int marginX = std::min(cacheMargin, view.width / 2);
+            int marginY = std::min(cacheMargin, view.height / 2);
+            area.x = std::max(0.0, view.x - marginX);
+            area.y = std::max(0.0, view.y - marginY);
+            area.width = view.width + 2 * marginX;
+            area.height = view.height + 2 * marginY;
+            if (scheduler->gridCache != nullptr)
+                cairo_surface_destroy(scheduler->gridCache);
+            scheduler->gridCache = cairo_surface_create_similar(cairo_get_target(cr), CAIRO_CONTENT_COLOR_ALPHA,
+                                                                area.width, area.height);
+            cairo_t *cacheCr = cairo_create(scheduler->gridCache);
+            gantt.renderStaticLayer(cacheCr, area);
+            cairo_destroy(cacheCr);
+            scheduler->cachedView = view;
+            scheduler->cachedArea = area;
         }
+        cairo_set_source_surface(cr, scheduler->gridCache, scheduler->cachedArea.x - view.x,
+                                 scheduler->cachedArea.y - view.y);
+        cairo_paint(cr);
 
-        // Dessiner les grilles et les processus
-        int row = 0; // Rangée initiale
-        int endPreProc = 0;
-        for (const auto& process : scheduler->processes) {
-            int startTime = endPreProc; // Correction ici
-            int endTime = startTime + process.burstTime;
-
-            // Couleur de la barre de progression
-            double r, g, b;
-            // std::tie(r, g, b) = colors[process.pid % colors.size()];
-            cairo_set_source_rgb(cr, 0.0, 0.0, 1.0);
-
-            // Dessiner la barre de progression en segments de 4 cases
-            for (int t = startTime; t < endTime; t += quantum) {
-                int segmentEnd = std::min(t + quantum, endTime);
-                for (int i = t; i < segmentEnd; ++i) {
-                    cairo_rectangle(cr, xOffset + i * cellWidth, yOffset + row * rowHeight, cellWidth, rowHeight);
-                    cairo_fill(cr);
-                }
-            }
+        return FALSE; // Indiquer que le dessin est terminé
+    }
 
-            // Dessiner les lignes de la grille
-            cairo_set_source_rgb(cr, 0, 0, 0); // Couleur noire pour les lignes
-            cairo_set_line_width(cr, 1);
-            for (int t = 0; t <= 50; ++t) { // Ajustez 50 pour le temps maximal
-                cairo_move_to(cr, xOffset + t * cellWidth, yOffset);
-                cairo_line_to(cr, xOffset + t * cellWidth, yOffset + (row + 1) * rowHeight);
-            }
-            cairo_move_to(cr, xOffset, yOffset + (row + 1) * rowHeight);
-            cairo_line_to(cr, xOffset + 50 * cellWidth, yOffset + (row + 1) * rowHeight); // Ligne horizontale
-            cairo_stroke(cr);
+    static void on_chart_resized(GtkWidget *widget, GdkRectangle *allocation, gpointer data) {
+        static_cast<Scheduler*>(data)->updateScrollRange();
+    }
 
-            // Ajouter le texte du nom du processus
-            cairo_set_source_rgb(cr, 0, 0, 0); // Noir
-            cairo_move_to(cr, 10, yOffset + row * rowHeight + rowHeight / 2);
-            cairo_show_text(cr, process.name.c_str());
+    static void on_scroll_changed(GtkAdjustment *adjustment, gpointer data) {
+        static_cast<Scheduler*>(data)->drawGrid();
+    }
 
-            row++; // Passer à la rangée suivante
-            endPreProc = endTime;
+    // Molette : défilement vertical, Maj + molette : horizontal, Ctrl + molette : zoom
+    static gboolean on_chart_scroll(GtkWidget *widget, GdkEventScroll *event, gpointer data) {
+        Scheduler *scheduler = static_cast<Scheduler*>(data);
+        double dx = 0, dy = 0;
+        if (event->direction == GDK_SCROLL_UP)
+            dy = -1;
+        else if (event->direction == GDK_SCROLL_DOWN)
+            dy = 1;
+        else if (event->direction == GDK_SCROLL_SMOOTH)
+            gdk_event_get_scroll_deltas(reinterpret_cast<GdkEvent*>(event), &dx, &dy);
+
+        if (event->state & GDK_CONTROL_MASK) {
+            scheduler->zoomAt(dy < 0 ? 1.25 : 0.8, event->x);
+        } else {
+            GtkAdjustment *adjustment = scheduler->vAdjustment;
+            if (event->state & GDK_SHIFT_MASK) {
+                adjustment = scheduler->hAdjustment;
+                dx += dy;
+                dy = 0;
+            }
+            double delta = adjustment == scheduler->hAdjustment ? dx : dy;
+            gtk_adjustment_set_value(adjustment, gtk_adjustment_get_value(adjustment) +
+                                     delta * gtk_adjustment_get_step_increment(adjustment) * 3);
         }
+        return TRUE;
+    }
 
-        // Dernière ligne horizontale pour fermer la grille
-        cairo_set_source_rgb(cr, 0, 0, 0);
-        cairo_move_to(cr, xOffset, yOffset + row * rowHeight);
-        cairo_line_to(cr, xOffset + 50 * cellWidth, yOffset + row * rowHeight);
-        cairo_stroke(cr);
+    static void onZoomInClicked(GtkWidget *widget, gpointer data) {
+        Scheduler *scheduler = static_cast<Scheduler*>(data);
+        scheduler->zoomAt(1.5, gtk_widget_get_allocated_width(scheduler->drawingArea) / 2.0);
+    }
 
-        scheduler->clearProcesses(); // Assurez-vous que cela est nécessaire
-        return FALSE; // Indiquer que le dessin est terminé
+    static void onZoomOutClicked(GtkWidget *widget, gpointer data) {
+        Scheduler *scheduler = static_cast<Scheduler*>(data);
+        scheduler->zoomAt(1 / 1.5, gtk_widget_get_allocated_width(scheduler->drawingArea) / 2.0);
     }
 
     void createGUI() {
@@ -349,7 +634,8 @@ public:
         GtkWidget *grid;
         GtkWidget *typeFrame, *paramsFrame, *buttonsFrame;
         GtkWidget *typeBox, *paramsBox, *buttonsBox;
-        GtkWidget *btnSchedule, *btnReset;
+        GtkWidget *btnZoomIn, *btnZoomOut;
+        GtkWidget *chartGrid;
 
         gtk_init(NULL, NULL);
 
@@ -365,17 +651,13 @@ public:
         typeBox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
         gtk_container_add(GTK_CONTAINER(typeFrame), typeBox);
 
-        fifoRadio = gtk_radio_button_new_with_label(NULL, "FIFO");
-        gtk_box_pack_start(GTK_BOX(typeBox), fifoRadio, FALSE, FALSE, 0);
-
-        priorityRadio = gtk_radio_button_new_with_label_from_widget(GTK_RADIO_BUTTON(fifoRadio), "Priorité avec préemption");
-        gtk_box_pack_start(GTK_BOX(typeBox), priorityRadio, FALSE, FALSE, 0);
-
-        roundRobinRadio = gtk_radio_button_new_with_label_from_widget(GTK_RADIO_BUTTON(fifoRadio), "Tourniquet");
-        gtk_box_pack_start(GTK_BOX(typeBox), roundRobinRadio, FALSE, FALSE, 0);
-
-        sjfRadio = gtk_radio_button_new_with_label_from_widget(GTK_RADIO_BUTTON(fifoRadio), "SJF");
-        gtk_box_pack_start(GTK_BOX(typeBox), sjfRadio, FALSE, FALSE, 0);
+        for (const PolicyInfo& info : policyRegistry()) {
+            GtkWidget *radio = policyRadios.empty()
+                ? gtk_radio_button_new_with_label(NULL, info.label)
+                : gtk_radio_button_new_with_label_from_widget(GTK_RADIO_BUTTON(policyRadios.front()), info.label);
+            gtk_box_pack_start(GTK_BOX(typeBox), radio, FALSE, FALSE, 0);
+            policyRadios.push_back(radio);
+        }
 
         gtk_grid_attach(GTK_GRID(grid), typeFrame, 0, 0, 1, 1);
 
@@ -392,13 +674,28 @@ public:
         gtk_box_pack_start(GTK_BOX(paramsBox), entryArrivals, FALSE, FALSE, 0);
 
         entryDurations = gtk_entry_new();
-        gtk_entry_set_placeholder_text(GTK_ENTRY(entryDurations), "Durée des processus (ex: 9,2,5,6)");
+        gtk_entry_set_placeholder_text(GTK_ENTRY(entryDurations), "Durée des processus (ex: 9,2,5,6 ; calcul/E-S/calcul : 4/3/2)");
         gtk_box_pack_start(GTK_BOX(paramsBox), entryDurations, FALSE, FALSE, 0);
 
         entryPriorities = gtk_entry_new();
         gtk_entry_set_placeholder_text(GTK_ENTRY(entryPriorities), "Priorité (ex: 1,2,3,4)");
         gtk_box_pack_start(GTK_BOX(paramsBox), entryPriorities, FALSE, FALSE, 0);
 
+        entryQuantum = gtk_entry_new();
+        gtk_entry_set_placeholder_text(GTK_ENTRY(entryQuantum), "Quantum du tourniquet (ex: 4, vide = automatique) ou quanta MLFQ et remontée (ex: 2,4,8;200)");
+        gtk_box_pack_start(GTK_BOX(paramsBox), entryQuantum, FALSE, FALSE, 0);
+
+        entryCpus = gtk_entry_new();
+        gtk_entry_set_placeholder_text(GTK_ENTRY(entryCpus), "Processeurs (ex: 4, vide = 1) et période d'équilibrage (ex: 4,20)");
+        gtk_box_pack_start(GTK_BOX(paramsBox), entryCpus, FALSE, FALSE, 0);
+
+        entryDeadlines = gtk_entry_new();
+        gtk_entry_set_placeholder_text(GTK_ENTRY(entryDeadlines), "Échéances pour EDF (ex: 10,0,25 ; 0 = aucune ; avec période : 25:40)");
+        gtk_box_pack_start(GTK_BOX(paramsBox), entryDeadlines, FALSE, FALSE, 0);
+
+        checkAdmission = gtk_check_button_new_with_label("Contrôle d'admission des processus à échéance");
+        gtk_box_pack_start(GTK_BOX(paramsBox), checkAdmission, FALSE, FALSE, 0);
+
         gtk_grid_attach(GTK_GRID(grid), paramsFrame, 1, 0, 1, 1);
 
         buttonsFrame = gtk_frame_new(NULL);
@@ -409,17 +706,42 @@ public:
         g_signal_connect(btnSchedule, "clicked", G_CALLBACK(onScheduleClicked), this);
 
         btnReset = gtk_button_new_with_label("Réinitialiser");
+        g_signal_connect(btnReset, "clicked", G_CALLBACK(onResetClicked), this);
         gtk_box_pack_start(GTK_BOX(buttonsBox), btnSchedule, TRUE, TRUE, 0);
         gtk_box_pack_start(GTK_BOX(buttonsBox), btnReset, TRUE, TRUE, 0);
 
+        btnZoomIn = gtk_button_new_with_label("Zoom +");
+        g_signal_connect(btnZoomIn, "clicked", G_CALLBACK(onZoomInClicked), this);
+        btnZoomOut = gtk_button_new_with_label("Zoom -");
+        g_signal_connect(btnZoomOut, "clicked", G_CALLBACK(onZoomOutClicked), this);
+        gtk_box_pack_start(GTK_BOX(buttonsBox), btnZoomIn, FALSE, FALSE, 0);
+        gtk_box_pack_start(GTK_BOX(buttonsBox), btnZoomOut, FALSE, FALSE, 0);
+
+        progressBar = gtk_progress_bar_new();
+        gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(progressBar), TRUE);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progressBar), "");
+        gtk_box_pack_start(GTK_BOX(buttonsBox), progressBar, TRUE, TRUE, 0);
+
         gtk_grid_attach(GTK_GRID(grid), buttonsFrame, 0, 1, 2, 1);
 
-        // Ajout de la zone de dessin
+        // Ajout de la zone de dessin, avec ses propres barres de défilement
+        chartGrid = gtk_grid_new();
+        hAdjustment = gtk_adjustment_new(0, 0, 0, 1, 1, 1);
+        vAdjustment = gtk_adjustment_new(0, 0, 0, 1, 1, 1);
+        g_signal_connect(hAdjustment, "value-changed", G_CALLBACK(on_scroll_changed), this);
+        g_signal_connect(vAdjustment, "value-changed", G_CALLBACK(on_scroll_changed), this);
+
         drawingArea = gtk_drawing_area_new();
         gtk_widget_set_hexpand(drawingArea, TRUE);  // Permet l'expansion horizontale
         gtk_widget_set_vexpand(drawingArea, TRUE);  // Permet l'expansion verticale
-        gtk_grid_attach(GTK_GRID(grid), drawingArea, 0, 2, 2, 1);
+        gtk_widget_add_events(drawingArea, GDK_SCROLL_MASK | GDK_SMOOTH_SCROLL_MASK);
+        gtk_grid_attach(GTK_GRID(chartGrid), drawingArea, 0, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(chartGrid), gtk_scrollbar_new(GTK_ORIENTATION_VERTICAL, vAdjustment), 1, 0, 1, 1);
+        gtk_grid_attach(GTK_GRID(chartGrid), gtk_scrollbar_new(GTK_ORIENTATION_HORIZONTAL, hAdjustment), 0, 1, 1, 1);
+        gtk_grid_attach(GTK_GRID(grid), chartGrid, 0, 2, 2, 1);
         g_signal_connect(drawingArea, "draw", G_CALLBACK(on_draw), this);
+        g_signal_connect(drawingArea, "size-allocate", G_CALLBACK(on_chart_resized), this);
+        g_signal_connect(drawingArea, "scroll-event", G_CALLBACK(on_chart_scroll), this);
 
         gtk_widget_show_all(window);
         gtk_main();
@@ -429,6 +751,10 @@ public:
         Scheduler *scheduler = static_cast<Scheduler*>(data);
         scheduler->showAlertWithValues();
     }
+
+    static void onResetClicked(GtkWidget *widget, gpointer data) {
+        static_cast<Scheduler*>(data)->reset();
+    }
 };
 
 int main() {
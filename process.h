@@ -0,0 +1,168 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <climits>
+
+// Table des processus rangée par colonnes (structure de tableaux) : chaque champ
+// est un tableau contigu de 32 bits, soit 32 octets par processus. Les noms ne
+// sont pas stockés, ils sont construits à la demande à partir du pid, et les tris
+// se font sur des tableaux d'indices sans déplacer les lignes.
+//
+// Un processus peut alterner rafales de calcul et attentes d'entrées-sorties :
+// burstTime est alors le total de ses calculs. Les colonnes correspondantes
+// restent vides tant qu'aucun processus n'en fait, une table de calcul pur ne
+// paie rien de plus. Il en va de même des échéances et des périodes (EDF).
+class ProcessTable {
+public:
+    std::vector<int> pid;
+    std::vector<int> arrivalTime;
+    std::vector<int> burstTime;
+    std::vector<int> priority;
+    std::vector<int> remainingTime;
+    std::vector<int> waitingTime;
+    std::vector<int> turnaroundTime;
+    std::vector<int> responseTime; // -1 tant que le processus n'a pas été servi
+
+    std::vector<int> ioTime;       // Total des attentes d'E/S
+    std::vector<int> firstPhase;   // Début de la suite de rafales dans `phases`, -1 : calcul pur
+    std::vector<int> phases;       // Par processus : nombre de rafales, puis calcul, E/S, ..., calcul
+
+    std::vector<int> deadline;     // Échéance relative à l'arrivée, -1 : aucune
+    std::vector<int> period;       // Période de la tâche dont le processus est une instance, 0 : aucune
+
+    size_t size() const {
+        return pid.size();
+    }
+
+    bool empty() const {
+        return pid.empty();
+    }
+
+    void add(int p, int at, int bt, int pr = 0) {
+        pid.push_back(p);
+        arrivalTime.push_back(at);
+        burstTime.push_back(bt);
+        priority.push_back(pr);
+        remainingTime.push_back(bt);
+        waitingTime.push_back(0);
+        turnaroundTime.push_back(0);
+        responseTime.push_back(-1); // Initialisation à -1 (non défini)
+        if (hasIo()) {
+            ioTime.push_back(0);
+            firstPhase.push_back(-1);
+        }
+        if (hasDeadlines()) {
+            deadline.push_back(-1);
+            period.push_back(0);
+        }
+    }
+
+    // Processus dont `bursts` alterne calcul et E/S, en commençant et en
+    // finissant par un calcul (une E/S finale est ignorée)
+    void addBursts(int p, int at, const std::vector<int>& bursts, int pr = 0) {
+        size_t count = bursts.size() % 2 == 0 && !bursts.empty() ? bursts.size() - 1 : bursts.size();
+        if (count <= 1) {
+            add(p, at, bursts.empty() ? 0 : bursts[0], pr);
+            return;
+        }
+        if (!hasIo()) {
+            ioTime.assign(size(), 0);
+            firstPhase.assign(size(), -1);
+        }
+        int first = static_cast<int>(phases.size());
+        int cpu = 0, io = 0;
+        phases.push_back(static_cast<int>(count));
+        for (size_t k = 0; k < count; ++k) {
+            phases.push_back(bursts[k]);
+            (k % 2 == 0 ? cpu : io) += bursts[k];
+        }
+        add(p, at, cpu, pr);
+        ioTime.back() = io;
+        firstPhase.back() = first;
+    }
+
+    bool hasIo() const {
+        return !phases.empty();
+    }
+
+    // Nombre de rafales de i, calculs et E/S confondus
+    int burstCount(size_t i) const {
+        return hasIo() && firstPhase[i] >= 0 ? phases[firstPhase[i]] : 1;
+    }
+
+    // Durée de la rafale k de i : calcul si k est pair, E/S sinon
+    int burst(size_t i, int k) const {
+        return hasIo() && firstPhase[i] >= 0 ? phases[firstPhase[i] + 1 + k] : burstTime[i];
+    }
+
+    int io(size_t i) const {
+        return hasIo() ? ioTime[i] : 0;
+    }
+
+    // Échéance `relative` (après l'arrivée) du processus i ; `taskPeriod` > 0
+    // en fait une instance de tâche périodique, pour le contrôle d'admission
+    void setDeadline(size_t i, int relative, int taskPeriod = 0) {
+        if (!hasDeadlines()) {
+            deadline.assign(size(), -1);
+            period.assign(size(), 0);
+        }
+        deadline[i] = relative;
+        period[i] = taskPeriod;
+    }
+
+    bool hasDeadlines() const {
+        return !deadline.empty();
+    }
+
+    bool hasDeadline(size_t i) const {
+        return hasDeadlines() && deadline[i] >= 0;
+    }
+
+    // Date absolue de l'échéance de i, LLONG_MAX s'il n'en a pas
+    long long dueTime(size_t i) const {
+        return hasDeadline(i) ? static_cast<long long>(arrivalTime[i]) + deadline[i] : LLONG_MAX;
+    }
+
+    void reserve(size_t n) {
+        for (auto* column : columns())
+            column->reserve(n);
+    }
+
+    void clear() {
+        for (auto* column : columns())
+            column->clear();
+        for (auto* column : ioColumns())
+            column->clear();
+        for (auto* column : deadlineColumns())
+            column->clear();
+    }
+
+    void shrink_to_fit() {
+        for (auto* column : columns())
+            column->shrink_to_fit();
+        for (auto* column : ioColumns())
+            column->shrink_to_fit();
+        for (auto* column : deadlineColumns())
+            column->shrink_to_fit();
+    }
+
+    // Nom affiché, construit uniquement quand on en a besoin
+    std::string name(size_t i) const {
+        return "Processus " + std::to_string(pid[i]);
+    }
+
+private:
+    std::vector<std::vector<int>*> columns() {
+        return {&pid, &arrivalTime, &burstTime, &priority,
+                &remainingTime, &waitingTime, &turnaroundTime, &responseTime};
+    }
+
+    std::vector<std::vector<int>*> ioColumns() {
+        return {&ioTime, &firstPhase, &phases};
+    }
+
+    std::vector<std::vector<int>*> deadlineColumns() {
+        return {&deadline, &period};
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include "arena.h"
+
+// File double d'identifiants dans un tableau circulaire dont la taille est une
+// puissance de deux : ajout et retrait aux deux bouts en O(1), sans allocation
+// par bloc d'éléments comme std::deque. Le tableau double quand il est plein ;
+// pris dans une arène, l'ancien y reste jusqu'à sa remise à zéro, soit au plus
+// le double de la plus grande taille atteinte.
+class RingQueue {
+private:
+    ArenaVector<std::uint32_t> ring;
+    size_t head = 0; // Position du premier élément
+    size_t count = 0;
+
+    size_t at(size_t k) const {
+        return (head + k) & (ring.size() - 1);
+    }
+
+    void grow() {
+        ArenaVector<std::uint32_t> larger(std::max<size_t>(16, 2 * ring.size()), 0, ring.get_allocator());
+        for (size_t k = 0; k < count; ++k)
+            larger[k] = ring[at(k)];
+        ring.swap(larger);
+        head = 0;
+    }
+
+public:
+    explicit RingQueue(Arena* arena = nullptr) : ring(ArenaAllocator<std::uint32_t>(arena)) {}
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    std::uint32_t front() const {
+        return ring[head];
+    }
+
+    std::uint32_t back() const {
+        return ring[at(count - 1)];
+    }
+
+    void push_back(std::uint32_t id) {
+        if (count == ring.size())
+            grow();
+        ring[at(count)] = id;
+        count++;
+    }
+
+    void push_front(std::uint32_t id) {
+        if (count == ring.size())
+            grow();
+        head = (head + ring.size() - 1) & (ring.size() - 1);
+        ring[head] = id;
+        count++;
+    }
+
+    void pop_front() {
+        head = at(1);
+        count--;
+    }
+
+    void pop_back() {
+        count--;
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    template <typename Iterator>
+    void assign(Iterator first, Iterator last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    // Contenu du premier au dernier
+    void copyTo(std::vector<std::uint32_t>& out) const {
+        out.resize(count);
+        for (size_t k = 0; k < count; ++k)
+            out[k] = ring[at(k)];
+    }
+};
@@ -0,0 +1,873 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <climits>
+#include <atomic>
+#include "process.h"
+#include "timeline.h"
+#include "policies.h"
+#include "histogram.h"
+#include "timing_wheel.h"
+#include "instrumentation.h"
+#include "arena.h"
+
+// Politiques d'ordonnancement disponibles (voir policyRegistry)
+enum class Policy {
+    FCFS,
+    SJF,
+    Priority,
+    RoundRobin,
+    PriorityPreemptive,
+    SRTF,
+    MLFQ,
+    EDF
+};
+
+// Suivi d'une simulation lancée dans un autre thread : avancement publié
+// périodiquement et demande d'annulation consultée par la boucle principale
+struct SimulationControl {
+    std::atomic<size_t> completed{0};  // Processus terminés
+    std::atomic<bool> cancelled{false};
+};
+
+// Machine simulée : nombre de processeurs, chacun avec sa propre file des
+// prêts, et équilibrage de la charge entre eux
+struct ProcessorConfig {
+    int cpus = 1;
+    int balancePeriod = 0;   // Migration périodique du plus chargé vers le moins
+                             // chargé à chaque multiple de cette durée (0 : jamais)
+    bool stealOnIdle = true; // Un processeur sans travail en prend au plus chargé
+    bool forceProcessorLoop = false; // Boucle multiprocesseur même sur un seul,
+                                     // pour la comparer à l'autre (check)
+};
+
+// Bilan d'un processeur à la fin de la simulation
+struct ProcessorStats {
+    long long busy = 0;       // Temps passé à exécuter des processus
+    size_t migratedIn = 0;    // Processus reçus d'un autre processeur
+    size_t migratedOut = 0;   // Processus cédés à un autre processeur
+};
+
+// Résultat d'une simulation en lecture seule, pour le dessin et les exports :
+// la table et les chronologies qu'elle a remplies, lues en place sans copie.
+// Valable tant que la simulation et ses chronologies existent.
+struct ScheduleView {
+    const ProcessTable* processes = nullptr;
+    const Timeline* timeline = nullptr;    // Monoprocesseur
+    std::vector<const Timeline*> lanes;    // Une par processeur en multiprocesseur
+    const Timeline* blocked = nullptr;     // Attentes d'E/S
+};
+
+class Simulation;
+
+// Entrée du registre des politiques : de quoi la proposer dans l'interface et
+// en ligne de commande, et la boucle de simulation spécialisée à exécuter
+struct PolicyInfo {
+    Policy policy;
+    const char* name;     // Nom en ligne de commande
+    const char* label;    // Libellé dans l'interface
+    bool usesQuantum;     // Le quantum s'applique (tourniquet, MLFQ)
+    void (Simulation::*simulate)();
+};
+
+inline const std::vector<PolicyInfo>& policyRegistry();
+inline const PolicyInfo& policyInfo(Policy policy);
+
+// Moteur de simulation à événements discrets partagé par toutes les politiques.
+// Les arrivées sont triées une seule fois, l'horloge saute directement à
+// l'événement suivant (arrivée ou fin d'exécution) au lieu d'avancer d'une unité
+// à la fois, et la file des prêts est un tas : O(n log n) au total.
+class Simulation {
+private:
+    ProcessTable& processes;
+    Timeline* timeline;                      // Chronologie à remplir (facultative)
+    Timeline* blockedTimeline = nullptr;     // Attentes d'E/S, dans l'ordre des réveils (facultative)
+    SimulationControl* control;              // Avancement et annulation (facultatif)
+    Profile* profile;                        // Durée des phases et compteurs (facultatif)
+    std::vector<std::uint32_t> arrivalOrder; // Indices triés par date d'arrivée
+    size_t nextArrival = 0;                  // Prochaine arrivée à traiter
+    int currentTime = 0;
+    size_t completed = 0;                    // Processus terminés
+    size_t events = 0;                       // Itérations de la boucle de simulation
+    bool cancelled = false;
+    Policy policy = Policy::FCFS;            // Politique de la dernière exécution
+    PolicyParameters parameters;
+    ProcessorConfig machine;
+    std::vector<Timeline*> lanes;            // Chronologie de chaque processeur (facultatives)
+    std::vector<ProcessorStats> processorStats;
+    LatencySummary latency;                  // Attente, rotation et réponse des terminés
+    DeadlineSummary deadlineStats;           // Retards et refus des processus à échéance
+    std::vector<int> phase;                  // Rafale en cours de chaque processus (avec E/S)
+    Arena arena;                             // Files des prêts et roue de la boucle en cours,
+                                             // rendues d'un coup au début de la suivante
+
+    // Contrôle d'admission des processus à échéance (voir admit), en
+    // 1/2^20 de processeur
+    static constexpr std::uint64_t shareUnit = 1 << 20;
+    bool admission = false;
+    std::uint64_t reserved = 0;              // Somme des réservations en cours
+    TimingWheel reservations{0};             // Fin de la réservation de chaque admis
+    int reservationOrigin = 0;               // Date 0 de la roue : la première arrivée
+                                             // si elle est négative, la roue n'en prenant pas
+
+    // Compteurs de la dernière exécution, relevés seulement avec
+    // SCHEDULER_INSTRUMENTATION (instrumentation.h), et ce qu'il faut en
+    // retenir pour chaque processeur
+    struct CpuTrace {
+        std::uint32_t last = UINT32_MAX; // Dernier processus exécuté
+        bool requeued = false;           // Remis en file avant la fin de sa rafale
+        bool idle = true;                // Sans tranche depuis `idleSince`
+        int idleSince = 0;
+    };
+    SchedulerCounters eventCounters;
+    std::vector<CpuTrace> cpuTraces;
+
+    void countPush(size_t depth) {
+        if constexpr (instrumented) {
+            eventCounters.pushes++;
+            eventCounters.maxDepth = std::max(eventCounters.maxDepth, depth);
+        }
+    }
+
+    void countRequeue(size_t c, size_t depth) {
+        if constexpr (instrumented) {
+            countPush(depth);
+            cpuTraces[c].requeued = true;
+        }
+    }
+
+    void countIdle(size_t c) {
+        if constexpr (instrumented) {
+            if (!cpuTraces[c].idle) {
+                cpuTraces[c].idle = true;
+                cpuTraces[c].idleSince = currentTime;
+            }
+        }
+    }
+
+    void countDispatch(size_t c, std::uint32_t i) {
+        if constexpr (instrumented) {
+            CpuTrace& t = cpuTraces[c];
+            eventCounters.pops++;
+            if (t.last != UINT32_MAX && t.last != i) {
+                eventCounters.contextSwitches++;
+                if (t.requeued)
+                    eventCounters.preemptions++;
+            }
+            if (t.idle && currentTime > t.idleSince) {
+                eventCounters.idleGaps++;
+                eventCounters.idleTime += currentTime - t.idleSince;
+            }
+            t = CpuTrace{i, false, false, 0};
+        }
+    }
+
+    // État complet de l'ordonnanceur en début d'itération : tout ce qui précède
+    // ne dépend que des processus arrivés avant `time`, on peut donc reprendre
+    // d'ici après la modification d'un processus arrivé plus tard
+    struct Checkpoint {
+        int time;
+        size_t nextArrival;
+        size_t completed;
+        LatencySummary latency;
+        DeadlineSummary deadlines;
+        Timeline::Mark timelineMark;
+        ReadySnapshot queue;              // File des prêts
+        std::vector<int> remaining;       // Temps restant de chacun
+        std::vector<int> response;        // Temps de réponse de chacun (-1 si pas encore servi)
+    };
+
+    // Au plus maxCheckpoints points de reprise : quand la liste est pleine, on en
+    // garde un sur deux et l'intervalle double, pour couvrir toute la simulation
+    // avec une mémoire bornée
+    static constexpr size_t maxCheckpoints = 32;
+    static constexpr size_t minCheckpointInterval = 16;
+    bool checkpointing = false;
+    size_t checkpointInterval = minCheckpointInterval;   // En itérations
+    size_t sinceCheckpoint = 0;
+    std::vector<Checkpoint> checkpoints;
+    ReadySnapshot resumeState;                           // File des prêts à restaurer
+
+    // Pas de points de reprise quand des processus font des E/S ni avec le
+    // contrôle d'admission : l'état des processus bloqués et les réservations
+    // n'y sont pas enregistrés, rewind() renvoie alors false
+    bool checkpointDue() {
+        return checkpointing && ++sinceCheckpoint >= checkpointInterval && !processes.hasIo() && !admission;
+    }
+
+    template <typename Queue>
+    void checkpoint(const Queue& readyQueue) {
+        sinceCheckpoint = 0;
+        if (checkpoints.size() == maxCheckpoints) {
+            size_t kept = 0;
+            for (size_t c = 1; c < checkpoints.size(); c += 2)
+                checkpoints[kept++] = std::move(checkpoints[c]);
+            checkpoints.resize(kept);
+            checkpointInterval *= 2;
+        }
+
+        Checkpoint c;
+        c.time = currentTime;
+        c.nextArrival = nextArrival;
+        c.completed = completed;
+        c.latency = latency;
+        c.deadlines = deadlineStats;
+        if (timeline != nullptr)
+            c.timelineMark = timeline->mark();
+        readyQueue.save(c.queue);
+        c.remaining.reserve(c.queue.ready.size());
+        c.response.reserve(c.queue.ready.size());
+        for (std::uint32_t i : c.queue.ready) {
+            c.remaining.push_back(processes.remainingTime[i]);
+            c.response.push_back(processes.responseTime[i]);
+        }
+        checkpoints.push_back(std::move(c));
+    }
+
+    // L'attente ne compte que le temps passé dans la file des prêts
+    void calculateWaitingAndTurnaround(std::uint32_t i, int endTime) {
+        processes.turnaroundTime[i] = endTime - processes.arrivalTime[i];
+        processes.waitingTime[i] = processes.turnaroundTime[i] - processes.burstTime[i] - processes.io(i);
+        latency.record(processes.waitingTime[i], processes.turnaroundTime[i], processes.responseTime[i]);
+        if (processes.hasDeadline(i))
+            deadlineStats.record(processes.turnaroundTime[i] - processes.deadline[i]);
+        completed++;
+    }
+
+    // Part de processeur réservée par i : sa durée de calcul sur sa période ou
+    // son échéance, la plus courte des deux, en unités de shareUnit arrondie
+    // au-dessus
+    std::uint64_t share(std::uint32_t i) const {
+        int window = processes.deadline[i];
+        if (processes.period[i] > 0)
+            window = std::min(window, processes.period[i]);
+        std::uint64_t work = static_cast<std::uint64_t>(processes.burstTime[i]) * shareUnit;
+        return (work + window - 1) / std::max(window, 1);
+    }
+
+    // Contrôle d'admission à l'arrivée de i. Un processus à échéance réserve
+    // share(i) de son arrivée jusqu'à celle de l'instance suivante de sa tâche
+    // (arrivée + période), ou à défaut jusqu'à son échéance ; il est refusé si
+    // les réservations en cours dépasseraient le nombre de processeurs. Sous
+    // EDF sur un processeur, c'est le test de densité : suffisant (aucun admis
+    // ne manque son échéance) mais pas nécessaire, il refuse des charges
+    // pourtant ordonnançables. Sur plusieurs processeurs la borne n'assure
+    // rien, pas plus que sous une autre politique, qui n'ordonne pas la file
+    // par échéance : un admis peut alors être en retard. Les
+    // réservations échues sont rendues par une roue temporelle, les arrivées
+    // étant traitées dans l'ordre : O(1) amorti par décision, quel que soit le
+    // nombre de processus admis. Un refusé garde -1 en attente, rotation et réponse.
+    bool admit(std::uint32_t i) {
+        if (!admission || !processes.hasDeadline(i))
+            return true;
+        long long now = static_cast<long long>(processes.arrivalTime[i]) - reservationOrigin;
+        while (!reservations.empty() && reservations.nextTime() <= now)
+            reservations.expireNext([&](std::uint32_t j) { reserved -= share(j); });
+        std::uint64_t needed = share(i);
+        if (reserved + needed > static_cast<std::uint64_t>(machine.cpus) * shareUnit) {
+            processes.waitingTime[i] = -1;
+            processes.turnaroundTime[i] = -1;
+            deadlineStats.rejected++;
+            return false;
+        }
+        reserved += needed;
+        int window = processes.period[i] > 0 ? processes.period[i] : processes.deadline[i];
+        reservations.schedule(i, static_cast<int>(std::min<long long>(INT_MAX, now + window)));
+        return true;
+    }
+
+    // Publie l'avancement et consulte la demande d'annulation toutes les 4096
+    // itérations, pour ne pas payer d'accès atomique à chaque événement
+    bool interrupted() {
+        if (control == nullptr || (++events & 4095) != 0)
+            return false;
+        control->completed.store(completed, std::memory_order_relaxed);
+        cancelled = control->cancelled.load(std::memory_order_relaxed);
+        return cancelled;
+    }
+
+    bool hasPendingArrival() const {
+        return nextArrival < arrivalOrder.size();
+    }
+
+    int nextArrivalTime() const {
+        return processes.arrivalTime[arrivalOrder[nextArrival]];
+    }
+
+    // Prochaine arrivée ou prochain réveil, INT_MAX s'il n'y en a plus
+    int nextEventTime(const TimingWheel& wheel) const {
+        int next = hasPendingArrival() ? nextArrivalTime() : INT_MAX;
+        return wheel.empty() ? next : std::min(next, wheel.nextTime());
+    }
+
+    // Ajoute à la file tous les processus arrivés ou réveillés au temps actuel,
+    // dans l'ordre chronologique ; à date égale, les arrivées d'abord
+    template <typename Push>
+    void admitArrivals(TimingWheel& wheel, Push push) {
+        while (true) {
+            int arrival = hasPendingArrival() ? nextArrivalTime() : INT_MAX;
+            int wake = wheel.empty() ? INT_MAX : wheel.nextTime();
+            if (std::min(arrival, wake) > currentTime)
+                return;
+            if (arrival <= wake) {
+                std::uint32_t i = arrivalOrder[nextArrival++];
+                if (admit(i))
+                    push(i);
+            } else {
+                wheel.expireNext([&](std::uint32_t i) {
+                    wakeUp(i, wake);
+                    push(i);
+                });
+            }
+        }
+    }
+
+    // Fin d'une rafale de calcul : s'il reste une E/S, le processus est bloqué
+    // jusqu'à son réveil par la roue. Renvoie false s'il est terminé.
+    bool blockForIo(std::uint32_t i, TimingWheel& wheel) {
+        if (phase.empty() || phase[i] + 1 >= processes.burstCount(i))
+            return false;
+        phase[i]++;
+        wheel.schedule(i, currentTime + processes.burst(i, phase[i]));
+        return true;
+    }
+
+    // Temps de calcul déjà reçu par i : ses rafales achevées et le début de
+    // la rafale en cours
+    int executed(std::uint32_t i) const {
+        if (phase.empty())
+            return processes.burstTime[i] - processes.remainingTime[i];
+        int done = 0;
+        for (int k = 0; k <= phase[i]; k += 2)
+            done += processes.burst(i, k);
+        return phase[i] % 2 == 0 ? done - processes.remainingTime[i] : done;
+    }
+
+    // Fin de l'E/S : la rafale de calcul suivante commence
+    void wakeUp(std::uint32_t i, int time) {
+        if (blockedTimeline != nullptr)
+            blockedTimeline->add(processes.pid[i], time - processes.burst(i, phase[i]), time);
+        phase[i]++;
+        processes.remainingTime[i] = processes.burst(i, phase[i]);
+    }
+
+    // Boucle unique, compilée pour chaque type de file des prêts (policies.h).
+    // Le processus choisi s'exécute jusqu'à sa fin, jusqu'à la fin de sa tranche,
+    // ou jusqu'à la prochaine arrivée si la politique l'y autorise : les décisions
+    // ne sont prises qu'aux événements, jamais à chaque unité de temps.
+    template <typename Queue>
+    void simulate() {
+        if (machine.cpus > 1 || machine.forceProcessorLoop) {
+            simulateProcessors<Queue>();
+            return;
+        }
+        arena.reset();
+        QueueStorage storage(processes.size(), &arena);
+        Queue readyQueue(processes, parameters, storage);
+        readyQueue.restore(resumeState);
+        TimingWheel wheel(processes.hasIo() ? processes.size() : 0, &arena);
+        auto push = [&](std::uint32_t i) {
+            readyQueue.push(i);
+            countPush(readyQueue.size());
+        };
+
+        while ((hasPendingArrival() || !readyQueue.empty() || !wheel.empty()) && !interrupted()) {
+            if (checkpointDue())
+                checkpoint(readyQueue);
+            // File vide : l'horloge saute directement à la prochaine arrivée ou au prochain réveil
+            if (readyQueue.empty()) {
+                countIdle(0);
+                currentTime = std::max(currentTime, nextEventTime(wheel));
+            }
+            admitArrivals(wheel, push);
+            if (readyQueue.empty())
+                continue; // Arrivées toutes refusées par le contrôle d'admission
+
+            Slice slice = readyQueue.pick(currentTime);
+            std::uint32_t current = slice.id;
+            countDispatch(0, current);
+            int& remaining = processes.remainingTime[current];
+
+            // Enregistrer le temps de réponse si c'est la première exécution
+            if (processes.responseTime[current] < 0)
+                processes.responseTime[current] = currentTime - processes.arrivalTime[current];
+
+            int until = currentTime + std::min(slice.length, remaining);
+            if (slice.interruptible)
+                until = std::min(until, nextEventTime(wheel));
+            if (timeline != nullptr)
+                timeline->add(processes.pid[current], currentTime, until);
+            int ran = until - currentTime;
+            remaining -= ran;
+            currentTime = until;
+
+            // Les processus arrivés pendant la tranche passent avant celui qu'on remet en file
+            admitArrivals(wheel, push);
+
+            if (remaining == 0) {
+                readyQueue.finish(current);
+                if (!blockForIo(current, wheel))
+                    calculateWaitingAndTurnaround(current, currentTime);
+            } else {
+                readyQueue.requeue(current, ran);
+                countRequeue(0, readyQueue.size());
+            }
+        }
+    }
+
+    // État d'un processeur dans la simulation multiprocesseur
+    struct Processor {
+        static constexpr std::uint32_t idle = UINT32_MAX;
+
+        std::uint32_t running = idle; // Processus en cours de tranche
+        int sliceStart = 0;
+        int event = 0;                // Fin de la tranche, ou date de la prochaine décision
+        bool interruptible = false;
+        size_t load = 0;              // Processus affectés : en attente et en cours
+    };
+
+    // Ordres des tas de processeurs, à égalité le plus petit numéro
+    struct EarlierEvent {
+        const ArenaVector<Processor>* cpu;
+
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            int ta = (*cpu)[a].event, tb = (*cpu)[b].event;
+            return ta != tb ? ta < tb : a < b;
+        }
+    };
+
+    struct LessLoaded {
+        const ArenaVector<Processor>* cpu;
+
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            size_t la = (*cpu)[a].load, lb = (*cpu)[b].load;
+            return la != lb ? la < lb : a < b;
+        }
+    };
+
+    struct MoreLoaded {
+        const ArenaVector<Processor>* cpu;
+
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            size_t la = (*cpu)[a].load, lb = (*cpu)[b].load;
+            return la != lb ? la > lb : a < b;
+        }
+    };
+
+    // Même boucle pour N processeurs, chacun avec sa file des prêts. Les
+    // processeurs sont ordonnés par date de leur prochain événement, et par
+    // charge pour le placement des arrivées (le moins chargé) et les migrations
+    // (du plus chargé) : chaque événement coûte O(log N), sans parcourir les
+    // processeurs ni verrou global. Une arrivée ou une migration vers un
+    // processeur interrompt sa tranche si la politique l'y autorise, comme une
+    // arrivée en monoprocesseur ; avec N = 1 les deux boucles coïncident.
+    // Pas de points de reprise ici : rewind() renvoie false et tout est resimulé.
+    template <typename Queue>
+    void simulateProcessors() {
+        const size_t cpus = static_cast<size_t>(machine.cpus);
+        arena.reset();
+        QueueStorage storage(processes.size(), &arena);
+        ArenaObjects<Queue> queues(arena, cpus, processes, parameters, storage);
+        ArenaVector<Processor> cpu(cpus, Processor(), ArenaAllocator<Processor>(&arena));
+        IndexedHeap<EarlierEvent> pending(cpus, EarlierEvent{&cpu}, &arena);
+        IndexedHeap<LessLoaded> lightest(cpus, LessLoaded{&cpu}, &arena);
+        IndexedHeap<MoreLoaded> heaviest(cpus, MoreLoaded{&cpu}, &arena);
+        for (std::uint32_t c = 0; c < cpus; ++c) {
+            lightest.push(c);
+            heaviest.push(c);
+        }
+        processorStats.assign(cpus, ProcessorStats());
+        TimingWheel wheel(processes.hasIo() ? processes.size() : 0, &arena);
+
+        auto addLoad = [&](std::uint32_t c, int delta) {
+            cpu[c].load += delta;
+            lightest.update(c);
+            heaviest.update(c);
+        };
+
+        // Un processus vient d'entrer dans la file de c : décision immédiate si
+        // c est inactif, fin anticipée de la tranche si elle est interruptible
+        auto wake = [&](std::uint32_t c) {
+            Processor& p = cpu[c];
+            if (p.running == Processor::idle) {
+                if (!pending.contains(c)) {
+                    p.event = currentTime;
+                    pending.push(c);
+                }
+            } else if (p.interruptible && p.event > currentTime) {
+                p.event = currentTime;
+                pending.update(c);
+            }
+        };
+
+        auto migrate = [&](std::uint32_t from, std::uint32_t to) {
+            std::uint32_t i;
+            if (!queues[from].extract(cpu[from].running, i))
+                return false;
+            queues[to].insert(i);
+            countPush(queues[to].size());
+            addLoad(from, -1);
+            addLoad(to, 1);
+            processorStats[from].migratedOut++;
+            processorStats[to].migratedIn++;
+            return true;
+        };
+
+        auto endSlice = [&](std::uint32_t c) {
+            Processor& p = cpu[c];
+            std::uint32_t current = p.running;
+            int ran = currentTime - p.sliceStart;
+            processes.remainingTime[current] -= ran;
+            processorStats[c].busy += ran;
+            if (!lanes.empty())
+                lanes[c]->add(processes.pid[current], p.sliceStart, currentTime);
+            p.running = Processor::idle;
+            if (processes.remainingTime[current] == 0) {
+                queues[c].finish(current);
+                if (!blockForIo(current, wheel))
+                    calculateWaitingAndTurnaround(current, currentTime);
+                addLoad(c, -1);
+            } else {
+                queues[c].requeue(current, ran);
+                countRequeue(c, queues[c].size());
+            }
+        };
+
+        auto dispatch = [&](std::uint32_t c) {
+            if (queues[c].empty() && machine.stealOnIdle) {
+                std::uint32_t victim = heaviest.top();
+                if (cpu[victim].load >= 2)
+                    migrate(victim, c);
+            }
+            if (queues[c].empty()) {
+                countIdle(c);
+                return;
+            }
+            Slice slice = queues[c].pick(currentTime);
+            Processor& p = cpu[c];
+            std::uint32_t current = slice.id;
+            countDispatch(c, current);
+            if (processes.responseTime[current] < 0)
+                processes.responseTime[current] = currentTime - processes.arrivalTime[current];
+            p.running = current;
+            p.sliceStart = currentTime;
+            p.event = currentTime + std::min(slice.length, processes.remainingTime[current]);
+            p.interruptible = slice.interruptible;
+            pending.push(c);
+        };
+
+        // Migration périodique : tant que l'écart dépasse un processus, et au
+        // plus autant de déplacements que de processeurs
+        auto balance = [&]() {
+            for (size_t moves = 0; moves < cpus; ++moves) {
+                std::uint32_t from = heaviest.top();
+                std::uint32_t to = lightest.top();
+                if (cpu[from].load < cpu[to].load + 2 || !migrate(from, to))
+                    break;
+                wake(to);
+            }
+        };
+
+        const int period = machine.balancePeriod;
+        int nextBalance = period;
+        while ((hasPendingArrival() || !pending.empty() || !wheel.empty()) && !interrupted()) {
+            int next = std::min(pending.empty() ? INT_MAX : cpu[pending.top()].event, nextEventTime(wheel));
+            if (period > 0 && !pending.empty() && nextBalance < next) {
+                currentTime = nextBalance;
+                balance();
+                nextBalance += period;
+                continue;
+            }
+            currentTime = next;
+
+            // Arrivées et réveils, chacun sur le processeur le moins chargé
+            admitArrivals(wheel, [&](std::uint32_t i) {
+                std::uint32_t c = lightest.top();
+                queues[c].push(i);
+                countPush(queues[c].size());
+                addLoad(c, 1);
+                wake(c);
+            });
+
+            // Fins de tranche et décisions de tous les processeurs à cette date
+            while (!pending.empty() && cpu[pending.top()].event == currentTime) {
+                std::uint32_t c = pending.top();
+                pending.pop();
+                if (cpu[c].running != Processor::idle)
+                    endSlice(c);
+                dispatch(c);
+            }
+
+            if (period > 0 && nextBalance <= currentTime) {
+                if (nextBalance == currentTime)
+                    balance();
+                nextBalance = (currentTime / period + 1) * period;
+            }
+        }
+    }
+
+    friend const std::vector<PolicyInfo>& policyRegistry();
+
+public:
+    explicit Simulation(ProcessTable& p, Timeline* t = nullptr, SimulationControl* c = nullptr,
+                        Profile* prof = nullptr)
+        : processes(p), timeline(t), control(c), profile(prof) {
+        reload();
+    }
+
+    // La table a été remplie de nouveau (autres processus, ou autre charge) :
+    // trie ses arrivées et oublie les points de reprise. La mémoire des
+    // exécutions précédentes est gardée, relancer run() sur une charge de même
+    // taille n'alloue rien.
+    void reload() {
+        ScopedPhase sorting(profile, "sort");
+        arrivalOrder.resize(processes.size());
+        for (size_t i = 0; i < processes.size(); ++i)
+            arrivalOrder[i] = static_cast<std::uint32_t>(i);
+        // Tri unique des arrivées ; à date égale, l'ordre de saisie (pid) est conservé
+        std::sort(arrivalOrder.begin(), arrivalOrder.end(), EarliestArrival(processes));
+        checkpoints.clear();
+    }
+
+    // Niveaux, quanta et période de remontée de la politique MLFQ
+    void configureFeedback(const FeedbackConfig& config) {
+        parameters.feedback = config;
+    }
+
+    // Chronologie des attentes d'E/S : un segment par attente, ajouté au réveil
+    // (les segments se chevauchent, leurs fins sont croissantes)
+    void recordBlocked(Timeline* t) {
+        blockedTimeline = t;
+    }
+
+    // Nombre de processeurs et équilibrage ; `cpuLanes`, s'il n'est pas vide,
+    // donne une chronologie par processeur. Sur un seul processeur, c'est la
+    // chronologie du constructeur qui est remplie.
+    void configureProcessors(const ProcessorConfig& config, std::vector<Timeline*> cpuLanes = {}) {
+        machine = config;
+        machine.cpus = std::max(1, config.cpus);
+        lanes = std::move(cpuLanes);
+        if (machine.cpus == 1)
+            lanes.clear();
+    }
+
+    // Temps d'exécution et migrations de chaque processeur lors du dernier run()
+    const std::vector<ProcessorStats>& processors() const {
+        return processorStats;
+    }
+
+    // Histogrammes des processus terminés, à jour à chaque fin d'exécution
+    const LatencySummary& latencies() const {
+        return latency;
+    }
+
+    // Contrôle d'admission des processus à échéance lors des prochains run()
+    // (voir admit) ; les refusés ne sont pas exécutés
+    void enableAdmission(bool enabled = true) {
+        admission = enabled;
+    }
+
+    // Échéances manquées, retards et refus, à jour à chaque fin d'exécution
+    const DeadlineSummary& deadlines() const {
+        return deadlineStats;
+    }
+
+    // Changements de contexte, préemptions, mouvements de la file des prêts et
+    // inactivités du dernier run() ou resume() ; nuls sans SCHEDULER_INSTRUMENTATION
+    const SchedulerCounters& counters() const {
+        return eventCounters;
+    }
+
+    // Table et chronologies remplies par le dernier run(), pour GanttChart et
+    // les exports ; seuls les processeurs de la configuration ont leur rangée
+    ScheduleView schedule() const {
+        ScheduleView view;
+        view.processes = &processes;
+        view.timeline = timeline;
+        view.lanes.assign(lanes.begin(), lanes.end());
+        view.blocked = blockedTimeline;
+        return view;
+    }
+
+    // Date de la dernière fin d'exécution, une fois la simulation terminée
+    int endTime() const {
+        return currentTime;
+    }
+
+    // Conserve des points de reprise pendant run(), pour pouvoir resimuler
+    // seulement la fin après une modification (voir rewind)
+    void enableCheckpoints(bool enabled = true) {
+        checkpointing = enabled;
+        if (!enabled)
+            checkpoints.clear();
+    }
+
+    // Renvoie false si la simulation a été annulée avant la fin
+    bool run(Policy p, int quantum = 4) {
+        policy = p;
+        parameters.quantum = quantum;
+        nextArrival = 0;
+        currentTime = 0;
+        completed = 0;
+        latency.clear();
+        deadlineStats.clear();
+        reserved = 0;
+        reservations.reset(admission && processes.hasDeadlines() ? processes.size() : 0);
+        reservationOrigin = arrivalOrder.empty() ? 0 : std::min(0, processes.arrivalTime[arrivalOrder[0]]);
+        cancelled = false;
+        checkpoints.clear();
+        checkpointInterval = std::max(minCheckpointInterval, processes.size() / maxCheckpoints);
+        sinceCheckpoint = 0;
+        resumeState = ReadySnapshot();
+        if (timeline != nullptr)
+            timeline->clear();
+        for (Timeline* lane : lanes)
+            lane->clear();
+        if (blockedTimeline != nullptr)
+            blockedTimeline->clear();
+        processes.remainingTime = processes.burstTime;
+        phase.clear();
+        if (processes.hasIo()) {
+            // Les processus avec E/S commencent par leur première rafale de calcul
+            phase.assign(processes.size(), 0);
+            for (size_t i = 0; i < processes.size(); ++i)
+                processes.remainingTime[i] = processes.burst(i, 0);
+        }
+        std::fill(processes.responseTime.begin(), processes.responseTime.end(), -1);
+        return resume();
+    }
+
+    // Les processus `edited` ont été modifiés dans la table (arrivée, durée ou
+    // priorité) depuis le dernier run() ; `oldArrivals` donne leur date
+    // d'arrivée d'avant. Restaure le dernier point de reprise antérieur à
+    // l'arrivée, ancienne comme nouvelle, de chacun : rien de ce qui précède ne
+    // dépend d'eux. Renvoie false s'il n'y en a pas, ou sans points de reprise
+    // (E/S, contrôle d'admission) : l'ordre des arrivées est à jour, il suffit
+    // de relancer run().
+    // Tronque la chronologie : comme Timeline::clear(), aucun autre thread ne
+    // doit la lire pendant l'appel. La simulation se poursuit avec resume().
+    bool rewind(const std::vector<std::uint32_t>& edited, const std::vector<int>& oldArrivals) {
+        int limit = INT_MAX;
+        for (size_t k = 0; k < edited.size(); ++k)
+            limit = std::min({limit, oldArrivals[k], processes.arrivalTime[edited[k]]});
+
+        // Remise en place des processus modifiés dans l'ordre des arrivées
+        std::vector<std::uint32_t> sortedEdits(edited);
+        std::sort(sortedEdits.begin(), sortedEdits.end());
+        arrivalOrder.erase(std::remove_if(arrivalOrder.begin(), arrivalOrder.end(),
+                                          [&](std::uint32_t i) {
+                                              return std::binary_search(sortedEdits.begin(), sortedEdits.end(), i);
+                                          }),
+                           arrivalOrder.end());
+        EarliestArrival byArrival(processes);
+        for (std::uint32_t i : sortedEdits)
+            arrivalOrder.insert(std::lower_bound(arrivalOrder.begin(), arrivalOrder.end(), i, byArrival), i);
+
+        if (processes.hasIo() || admission)
+            return false;
+
+        // Dernier point pris strictement avant la première arrivée modifiée
+        auto after = std::partition_point(checkpoints.begin(), checkpoints.end(),
+                                          [limit](const Checkpoint& c) { return c.time < limit; });
+        if (after == checkpoints.begin())
+            return false;
+        checkpoints.erase(after, checkpoints.end());
+        const Checkpoint& c = checkpoints.back();
+
+        currentTime = c.time;
+        nextArrival = c.nextArrival;
+        completed = c.completed;
+        latency = c.latency;
+        deadlineStats = c.deadlines;
+        cancelled = false;
+        sinceCheckpoint = 0;
+        if (timeline != nullptr)
+            timeline->rewind(c.timelineMark);
+        // Les processus pas encore arrivés repartent de zéro, ceux de la file
+        // retrouvent leur état ; les terminés gardent leurs résultats
+        for (size_t k = nextArrival; k < arrivalOrder.size(); ++k) {
+            std::uint32_t i = arrivalOrder[k];
+            processes.remainingTime[i] = processes.burstTime[i];
+            processes.responseTime[i] = -1;
+        }
+        resumeState = c.queue;
+        for (size_t k = 0; k < c.queue.ready.size(); ++k) {
+            processes.remainingTime[c.queue.ready[k]] = c.remaining[k];
+            processes.responseTime[c.queue.ready[k]] = c.response[k];
+        }
+        return true;
+    }
+
+    // Poursuit la simulation depuis l'état courant (début, ou point restauré par
+    // rewind) avec la politique du dernier run(). Renvoie false si elle a été annulée.
+    bool resume() {
+        events = 0;
+        {
+            ScopedPhase simulating(profile, "simulate");
+            eventCounters = SchedulerCounters();
+            if constexpr (instrumented)
+                cpuTraces.assign(machine.cpus, CpuTrace{UINT32_MAX, false, true, currentTime});
+            (this->*policyInfo(policy).simulate)();
+        }
+        if constexpr (instrumented)
+            if (profile != nullptr)
+                profile->add(eventCounters);
+        resumeState = ReadySnapshot();
+        if (machine.cpus == 1 && !machine.forceProcessorLoop) {
+            // Un seul processeur : il a exécuté tout ce qui a été exécuté
+            long long busy = 0;
+            for (size_t i = 0; i < processes.size(); ++i)
+                busy += executed(i);
+            processorStats.assign(1, ProcessorStats());
+            processorStats[0].busy = busy;
+        }
+        if (timeline != nullptr)
+            timeline->flush();
+        for (Timeline* lane : lanes)
+            lane->flush();
+        if (blockedTimeline != nullptr)
+            blockedTimeline->flush();
+        if (control != nullptr)
+            control->completed.store(completed, std::memory_order_relaxed);
+        return !cancelled;
+    }
+};
+
+// Registre des politiques, dans l'ordre de Policy. Chaque entrée associe une
+// file des prêts à la boucle de simulation spécialisée pour elle.
+inline const std::vector<PolicyInfo>& policyRegistry() {
+    static const std::vector<PolicyInfo> registry = {
+        {Policy::FCFS, "fcfs", "FIFO", false,
+         &Simulation::simulate<FifoQueue>},
+        {Policy::SJF, "sjf", "SJF", false,
+         &Simulation::simulate<NonPreemptiveQueue<ShortestBurst>>},
+        {Policy::Priority, "priority", "Priorité sans préemption", false,
+         &Simulation::simulate<NonPreemptiveQueue<HighestPriority>>},
+        {Policy::RoundRobin, "rr", "Tourniquet", true,
+         &Simulation::simulate<RoundRobinQueue>},
+        {Policy::PriorityPreemptive, "priority-preemptive", "Priorité avec préemption", false,
+         &Simulation::simulate<PreemptiveQueue<HighestPriority>>},
+        {Policy::SRTF, "srtf", "SRTF", false,
+         &Simulation::simulate<PreemptiveQueue<ShortestRemaining>>},
+        {Policy::MLFQ, "mlfq", "MLFQ", true,
+         &Simulation::simulate<MlfqQueue>},
+        {Policy::EDF, "edf", "EDF (échéance la plus proche)", false,
+         &Simulation::simulate<PreemptiveQueue<EarliestDeadline>>},
+    };
+    return registry;
+}
+
+inline const PolicyInfo& policyInfo(Policy policy) {
+    return policyRegistry()[static_cast<size_t>(policy)];
+}
+
+// Politique désignée par son nom en ligne de commande, nullptr si inconnue
+inline const PolicyInfo* findPolicy(const std::string& name) {
+    for (const PolicyInfo& info : policyRegistry())
+        if (name == info.name)
+            return &info;
+    return nullptr;
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include "process.h"
+#include "simulation.h"
+#include "histogram.h"
+
+// Une combinaison (politique, quantum, charge) à évaluer
+struct SweepConfig {
+    Policy policy;
+    int quantum;
+    size_t workload; // Indice de la charge dans le balayage
+};
+
+// Résultat d'une configuration : les histogrammes de ses processus, qui
+// s'additionnent pour juger une configuration sur plusieurs charges
+struct SweepResult {
+    SweepConfig config;
+    LatencySummary latency;
+};
+
+// Critère à minimiser pour choisir la meilleure configuration
+enum class Objective {
+    MeanWaiting,
+    P99Waiting,
+    P999Waiting,
+    MeanResponse,
+    P99Response,
+    P999Response
+};
+
+inline double objectiveValue(const LatencySummary& latency, Objective objective) {
+    switch (objective) {
+    case Objective::MeanWaiting:
+        return latency.waiting.mean();
+    case Objective::P99Waiting:
+        return latency.waiting.percentile(0.99);
+    case Objective::P999Waiting:
+        return latency.waiting.percentile(0.999);
+    case Objective::MeanResponse:
+        return latency.response.mean();
+    case Objective::P99Response:
+        return latency.response.percentile(0.99);
+    case Objective::P999Response:
+        return latency.response.percentile(0.999);
+    }
+    return latency.waiting.mean();
+}
+
+inline double objectiveValue(const SweepResult& result, Objective objective) {
+    return objectiveValue(result.latency, objective);
+}
+
+// Balayage de paramètres exécuté en parallèle. Les charges sont figées une fois
+// ajoutées et partagées en lecture seule entre les threads ; chaque thread
+// simule sur sa propre copie de travail, avec sa propre simulation, réutilisées
+// d'une configuration à l'autre : une fois la plus grande charge passée, les
+// configurations suivantes n'allouent plus rien.
+// Les centiles viennent des histogrammes remplis pendant la simulation : pas de
+// copie ni de tri des colonnes.
+class ParameterSweep {
+private:
+    std::vector<std::shared_ptr<const ProcessTable>> workloads;
+    std::vector<SweepConfig> configs;
+    ProcessorConfig machine;
+    FeedbackConfig feedbackConfig;
+    bool admission = false;
+    Profile* profile = nullptr;
+
+    SweepResult evaluate(const SweepConfig& config, ProcessTable& scratch, Simulation& simulation) const {
+        scratch = *workloads[config.workload];
+        simulation.reload();
+        simulation.configureFeedback(feedbackConfig);
+        simulation.configureProcessors(machine);
+        simulation.enableAdmission(admission);
+        simulation.run(config.policy, config.quantum);
+        return {config, simulation.latencies()};
+    }
+
+public:
+    // Fige une charge et renvoie son indice
+    size_t addWorkload(ProcessTable processes) {
+        workloads.push_back(std::make_shared<const ProcessTable>(std::move(processes)));
+        return workloads.size() - 1;
+    }
+
+    // Processeurs de toutes les configurations (un seul par défaut)
+    void configureProcessors(const ProcessorConfig& config) {
+        machine = config;
+    }
+
+    // Niveaux et période de remontée de MLFQ dans toutes les configurations ;
+    // sans niveaux, le quantum de chaque configuration fixe celui du premier
+    void configureFeedback(const FeedbackConfig& config) {
+        feedbackConfig = config;
+    }
+
+    const FeedbackConfig& feedback() const {
+        return feedbackConfig;
+    }
+
+    // Contrôle d'admission des processus à échéance dans toutes les
+    // configurations ; les refusés ne comptent pas dans les latences
+    void enableAdmission(bool enabled = true) {
+        admission = enabled;
+    }
+
+    bool admissionEnabled() const {
+        return admission;
+    }
+
+    // Phases et compteurs de chaque simulation, relevés depuis tous les threads
+    void instrument(Profile* p) {
+        profile = p;
+    }
+
+    const ProcessTable& workload(size_t w) const {
+        return *workloads[w];
+    }
+
+    size_t workloadCount() const {
+        return workloads.size();
+    }
+
+    void add(Policy policy, int quantum, size_t workload) {
+        configs.push_back({policy, quantum, workload});
+    }
+
+    // Produit cartésien sur toutes les charges ; le quantum ne compte que pour le
+    // tourniquet et pour MLFQ, dont il fixe le quantum du premier niveau
+    void addAll(const std::vector<Policy>& policies, const std::vector<int>& quantums) {
+        for (size_t w = 0; w < workloads.size(); ++w) {
+            for (Policy policy : policies) {
+                if (!policyInfo(policy).usesQuantum) {
+                    add(policy, 0, w);
+                    continue;
+                }
+                for (int quantum : quantums)
+                    add(policy, quantum, w);
+            }
+        }
+    }
+
+    size_t size() const {
+        return configs.size();
+    }
+
+    // Évalue toutes les configurations ; les résultats sont dans l'ordre des
+    // ajouts. Si `control->cancelled` passe à vrai, chaque thread s'arrête après
+    // la simulation en cours : les résultats sont alors incomplets.
+    std::vector<SweepResult> run(unsigned threads = 0, const SimulationControl* control = nullptr) const {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(configs.size(), 1)));
+
+        std::vector<SweepResult> results(configs.size());
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            ProcessTable scratch;
+            Simulation simulation(scratch, nullptr, nullptr, profile);
+            for (size_t i = next++; i < configs.size(); i = next++) {
+                if (control != nullptr && control->cancelled.load(std::memory_order_relaxed))
+                    break;
+                results[i] = evaluate(configs[i], scratch, simulation);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t)
+            pool.emplace_back(worker);
+        worker();
+        for (auto& thread : pool)
+            thread.join();
+        return results;
+    }
+
+    // Meilleur résultat selon `objective`, éventuellement restreint à une charge
+    static const SweepResult* best(const std::vector<SweepResult>& results, Objective objective,
+                                   size_t workload = SIZE_MAX) {
+        const SweepResult* bestResult = nullptr;
+        for (const auto& result : results) {
+            if (workload != SIZE_MAX && result.config.workload != workload)
+                continue;
+            if (bestResult == nullptr || objectiveValue(result, objective) < objectiveValue(*bestResult, objective))
+                bestResult = &result;
+        }
+        return bestResult;
+    }
+};
+
+// Choisit le quantum du tourniquet qui minimise `objective` sur la charge
+// donnée, simulée sur les processeurs `machine` ; 0 si `control` l'annule
+inline int autotuneQuantum(const ProcessTable& processes, const ProcessorConfig& machine = ProcessorConfig(),
+                           Objective objective = Objective::MeanWaiting, int maxQuantum = 0,
+                           const SimulationControl* control = nullptr) {
+    if (maxQuantum <= 0) {
+        maxQuantum = 1;
+        for (int burst : processes.burstTime)
+            maxQuantum = std::max(maxQuantum, burst);
+        maxQuantum = std::min(maxQuantum, 256);
+    }
+    ParameterSweep sweep;
+    sweep.configureProcessors(machine);
+    sweep.addWorkload(processes);
+    std::vector<int> quantums;
+    for (int q = 1; q <= maxQuantum; ++q)
+        quantums.push_back(q);
+    sweep.addAll({Policy::RoundRobin}, quantums);
+    std::vector<SweepResult> results = sweep.run(0, control);
+    if (control != nullptr && control->cancelled)
+        return 0;
+    const SweepResult* bestResult = ParameterSweep::best(results, objective);
+    return bestResult != nullptr ? bestResult->config.quantum : 4;
+}
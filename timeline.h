@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+// Intervalle pendant lequel un processus occupe le processeur
+struct Segment {
+    int pid;
+    int start;
+    int end;
+};
+
+// Chronologie d'exécution produite une seule fois par la simulation.
+// Les segments sont ajoutés dans l'ordre du temps et ne se chevauchent pas
+// (sauf la chronologie des attentes d'E/S, ordonnée seulement par fin).
+//
+// Un seul thread écrit (la simulation), d'autres peuvent lire pendant ce temps
+// (le dessin du diagramme) sans verrou : les segments sont rangés dans des blocs
+// qui ne sont jamais déplacés, et ne deviennent visibles qu'une fois complets,
+// par la publication atomique de leur nombre. Le dernier segment reste privé
+// tant qu'il peut encore être prolongé.
+class Timeline {
+private:
+    static constexpr size_t chunkBits = 14;
+    static constexpr size_t chunkSize = size_t(1) << chunkBits; // Segments par bloc
+    static constexpr size_t maxChunks = size_t(1) << 16;         // Soit 2^30 segments
+
+    std::unique_ptr<std::atomic<Segment*>[]> chunks; // Répertoire des blocs, alloué au premier ajout
+    std::atomic<size_t> published{0};                 // Segments visibles par les lecteurs
+    size_t stored = 0;                                // Segments écrits dans les blocs
+    Segment pending = {0, 0, 0};                      // Dernier segment, encore modifiable
+    bool hasPending = false;
+
+    Segment* chunk(size_t i) const {
+        return chunks[i >> chunkBits].load(std::memory_order_relaxed);
+    }
+
+    void store(const Segment& segment) {
+        if (chunks == nullptr) {
+            chunks.reset(new std::atomic<Segment*>[maxChunks]);
+            for (size_t c = 0; c < maxChunks; ++c)
+                chunks[c].store(nullptr, std::memory_order_relaxed);
+        }
+        size_t c = stored >> chunkBits;
+        if (c >= maxChunks)
+            return; // Capacité dépassée : les segments suivants sont ignorés
+        if (chunks[c].load(std::memory_order_relaxed) == nullptr)
+            chunks[c].store(new Segment[chunkSize], std::memory_order_relaxed);
+        chunk(stored)[stored & (chunkSize - 1)] = segment;
+        stored++;
+        published.store(stored, std::memory_order_release);
+    }
+
+public:
+    // Position de l'écrivain, pour revenir en arrière lors d'une reprise
+    struct Mark {
+        size_t stored;
+        Segment pending;
+        bool hasPending;
+    };
+
+    Timeline() = default;
+
+    ~Timeline() {
+        if (chunks == nullptr)
+            return;
+        for (size_t c = 0; c < maxChunks; ++c)
+            delete[] chunks[c].load(std::memory_order_relaxed);
+    }
+
+    Timeline(const Timeline&) = delete;
+    Timeline& operator=(const Timeline&) = delete;
+
+    // Ajoute un segment, fusionné avec le précédent s'il le prolonge (écrivain seul)
+    void add(int pid, int start, int end) {
+        if (end <= start)
+            return;
+        if (hasPending && pending.pid == pid && pending.end == start) {
+            pending.end = end;
+            return;
+        }
+        if (hasPending)
+            store(pending);
+        pending = {pid, start, end};
+        hasPending = true;
+    }
+
+    // Publie le dernier segment en fin de simulation
+    void flush() {
+        if (hasPending)
+            store(pending);
+        hasPending = false;
+    }
+
+    // Vide la chronologie ; les blocs sont conservés pour la simulation suivante.
+    // Ne doit pas être appelée pendant qu'un autre thread lit.
+    void clear() {
+        stored = 0;
+        hasPending = false;
+        published.store(0, std::memory_order_release);
+    }
+
+    Mark mark() const {
+        return {stored, pending, hasPending};
+    }
+
+    // Revient à une position enregistrée par mark() ; comme clear(), ne doit pas
+    // être appelée pendant qu'un autre thread lit
+    void rewind(const Mark& m) {
+        stored = m.stored;
+        pending = m.pending;
+        hasPending = m.hasPending;
+        published.store(stored, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Nombre de segments publiés, lisible depuis n'importe quel thread
+    size_t size() const {
+        return published.load(std::memory_order_acquire);
+    }
+
+    const Segment& operator[](size_t i) const {
+        return chunk(i)[i & (chunkSize - 1)];
+    }
+
+    // Fin du dernier segment publié, c'est-à-dire la durée totale une fois la simulation finie
+    int endTime() const {
+        size_t n = size();
+        return n == 0 ? 0 : (*this)[n - 1].end;
+    }
+
+    // Indice du premier segment qui se termine après `time` (recherche dichotomique)
+    size_t firstEndingAfter(int time) const {
+        size_t low = 0;
+        size_t high = size();
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if ((*this)[middle].end <= time)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+};
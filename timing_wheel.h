@@ -0,0 +1,143 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include "arena.h"
+
+// Roue temporelle hiérarchique pour les réveils de fin d'E/S, sur des
+// identifiants 0..n-1 et des dates entières positives. Six niveaux de 64 cases
+// couvrent toutes les dates d'un int : une échéance va au niveau du bit de
+// poids fort où elle diffère de l'instant courant de la roue, dans la case des
+// 6 bits correspondants. L'insertion est en O(1). Quand la roue avance, la case
+// atteinte à chaque niveau est redistribuée vers les niveaux inférieurs : une
+// échéance est déplacée au plus six fois avant d'expirer. Un bitmap par niveau
+// note les cases non vides et chaque case retient sa plus petite échéance, si
+// bien que la prochaine date se lit en O(niveaux), sans parcourir les cases.
+// Les tableaux par identifiant peuvent être pris dans une arène.
+class TimingWheel {
+public:
+    static constexpr int levelBits = 6;
+    static constexpr int slots = 1 << levelBits;
+    static constexpr int levels = 6;
+
+private:
+    static constexpr std::uint32_t none = UINT32_MAX;
+
+    ArenaVector<std::uint32_t> next; // Suivant de chaque identifiant dans sa case
+    ArenaVector<int> due;            // Échéance de chaque identifiant
+    std::uint32_t head[levels][slots];
+    std::uint32_t tail[levels][slots];
+    int earliest[levels][slots];     // Plus petite échéance de chaque case non vide
+    std::uint64_t occupied[levels] = {};
+    int now = 0;                     // Instant courant : dernière date d'expiration
+    size_t count = 0;
+    ArenaVector<std::uint32_t> expired;
+
+    void place(std::uint32_t id) {
+        int time = due[id];
+        unsigned differ = static_cast<unsigned>(time ^ now);
+        int level = differ == 0 ? 0 : (31 - __builtin_clz(differ)) / levelBits;
+        int slot = (time >> (level * levelBits)) & (slots - 1);
+        next[id] = none;
+        if (head[level][slot] == none) {
+            head[level][slot] = id;
+            earliest[level][slot] = time;
+            occupied[level] |= std::uint64_t(1) << slot;
+        } else {
+            next[tail[level][slot]] = id;
+            earliest[level][slot] = std::min(earliest[level][slot], time);
+        }
+        tail[level][slot] = id;
+    }
+
+    // La roue passe à `time`, qui ne dépasse aucune échéance : à chaque niveau,
+    // la case qui contient `time` est redistribuée plus bas
+    void advance(int time) {
+        now = time;
+        for (int level = levels - 1; level > 0; --level) {
+            int slot = (time >> (level * levelBits)) & (slots - 1);
+            if ((occupied[level] >> slot & 1) == 0)
+                continue;
+            std::uint32_t id = head[level][slot];
+            head[level][slot] = tail[level][slot] = none;
+            occupied[level] &= ~(std::uint64_t(1) << slot);
+            while (id != none) {
+                std::uint32_t following = next[id];
+                place(id);
+                id = following;
+            }
+        }
+    }
+
+public:
+    explicit TimingWheel(size_t capacity, Arena* arena = nullptr)
+        : next(capacity, none, ArenaAllocator<std::uint32_t>(arena)), due(capacity, 0, ArenaAllocator<int>(arena)),
+          expired(ArenaAllocator<std::uint32_t>(arena)) {
+        for (int level = 0; level < levels; ++level)
+            for (int slot = 0; slot < slots; ++slot)
+                head[level][slot] = tail[level][slot] = none;
+    }
+
+    // Vide la roue et la remet à l'instant 0 pour `capacity` identifiants, en
+    // gardant ses tableaux : aucune allocation d'une exécution à l'autre
+    void reset(size_t capacity) {
+        next.assign(capacity, none);
+        due.assign(capacity, 0);
+        expired.clear();
+        for (int level = 0; level < levels; ++level)
+            for (int slot = 0; slot < slots; ++slot)
+                head[level][slot] = tail[level][slot] = none;
+        std::fill(occupied, occupied + levels, 0);
+        now = 0;
+        count = 0;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Réveil de `id` à `time`, postérieur à la dernière expiration
+    void schedule(std::uint32_t id, int time) {
+        due[id] = time;
+        place(id);
+        count++;
+    }
+
+    // Prochaine échéance (roue non vide). Les cases d'un niveau sont toutes
+    // postérieures à l'instant courant et antérieures à celles des niveaux
+    // supérieurs : c'est la première case non vide du premier niveau non vide.
+    int nextTime() const {
+        for (int level = 0; level < levels; ++level)
+            if (occupied[level] != 0)
+                return earliest[level][__builtin_ctzll(occupied[level])];
+        return INT_MAX;
+    }
+
+    // Retire tous les identifiants de la prochaine échéance et les passe à
+    // `wake` dans l'ordre croissant, pour un résultat reproductible ; renvoie
+    // cette échéance
+    template <typename Wake>
+    int expireNext(Wake wake) {
+        int time = nextTime();
+        advance(time);
+        int slot = time & (slots - 1);
+        expired.clear();
+        for (std::uint32_t id = head[0][slot]; id != none; id = next[id])
+            expired.push_back(id);
+        head[0][slot] = tail[0][slot] = none;
+        occupied[0] &= ~(std::uint64_t(1) << slot);
+        count -= expired.size();
+        if (expired.size() > 1)
+            std::sort(expired.begin(), expired.end());
+        for (std::uint32_t id : expired)
+            wake(id);
+        return time;
+    }
+};
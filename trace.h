@@ -0,0 +1,399 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include "mapped_file.h"
+#include "process.h"
+#include "histogram.h"
+
+// Charge reconstituée à partir d'une trace de l'ordonnanceur Linux, avec ce que
+// le noyau a réellement fait, pour comparer les politiques simulées au réel
+struct TraceWorkload {
+    ProcessTable processes;         // Une ligne par tâche (pids 1..n), calculs et E/S
+    std::vector<int> tid;           // Pid Linux de chaque processus
+    std::vector<std::string> comm;  // Nom de la tâche au moment de sa création
+    LatencySummary kernel;          // Attente, rotation et réponse observées dans la trace
+    int cpus = 1;                   // Processeurs vus dans la trace
+    size_t events = 0;              // Événements sched_switch et sched_wakeup décodés
+    size_t bytes = 0;               // Taille de la trace
+};
+
+// Lecture en flux d'une trace texte de l'ordonnanceur : sortie de ftrace
+// (trace ou trace_pipe avec sched_switch et sched_wakeup activés) ou de
+// `perf sched script`, au format clé=valeur comme au format compact des
+// anciennes versions de perf. Le fichier est mappé et décodé ligne par ligne
+// sans copie, comme les charges CSV ; seul l'état des tâches vivantes est gardé.
+//
+// Chaque tâche devient un processus : elle arrive à son premier réveil (ou à
+// sa première exécution si le réveil n'est pas tracé), ses rafales de calcul
+// vont d'un réveil au sched_switch qui l'endort, ses E/S de cet endormissement
+// au réveil suivant. Une tâche préemptée (état R) reste prête. Elle se termine
+// à sa sortie (état X ou Z), ou à la fin de la trace : un dernier sommeil est
+// alors ignoré. Les temps sont comptés en unités de `tick` nanosecondes depuis
+// le premier événement ; une rafale de calcul plus courte compte une unité.
+class TraceReader {
+private:
+    struct Task {
+        enum State : unsigned char { Sleeping, Runnable, Running };
+
+        int tid = 0;
+        int priority = 0;
+        State state = Runnable;
+        int arrival = 0;
+        int since = 0;        // Dernier changement d'état
+        int firstRun = -1;
+        int lastStop = 0;     // Dernière fin d'exécution
+        int waiting = 0;      // Temps passé prêt sans s'exécuter
+        int burst = 0;        // Rafale de calcul en cours
+        std::vector<int> bursts;
+        std::string comm;
+    };
+
+    // Champs d'une ligne sched_switch ou sched_wakeup
+    struct Event {
+        bool isSwitch;
+        int cpu;
+        long long ns;
+        int prevPid, prevPrio;
+        char prevState;
+        int pid, prio;         // Tâche réveillée, ou élue (next) pour sched_switch
+        std::string_view comm;
+    };
+
+    MappedFile file;
+    long long tick;
+    long long origin = -1;     // Date du premier événement, en nanosecondes
+    int now = 0;
+    std::vector<Task> tasks;
+    std::vector<std::uint32_t> freeTasks;
+    std::vector<std::int32_t> taskOf; // Tâche vivante de chaque pid Linux, -1 sinon
+    TraceWorkload result;
+
+    static bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool parseInt(std::string_view s, int& value) {
+        size_t k = 0;
+        bool negative = k < s.size() && s[k] == '-';
+        if (negative)
+            ++k;
+        if (k == s.size() || !isDigit(s[k]))
+            return false;
+        long long v = 0;
+        for (; k < s.size() && isDigit(s[k]); ++k) {
+            v = v * 10 + (s[k] - '0');
+            if (v > INT_MAX)
+                return false;
+        }
+        value = static_cast<int>(negative ? -v : v);
+        return true;
+    }
+
+    // Entier qui suit `key` dans `s`, à partir de `from`
+    static bool field(std::string_view s, std::string_view key, int& value, size_t from = 0) {
+        size_t at = s.find(key, from);
+        return at != std::string_view::npos && parseInt(s.substr(at + key.size()), value);
+    }
+
+    // "secondes.fraction" en nanosecondes
+    static bool parseTimestamp(std::string_view s, long long& ns) {
+        size_t dot = s.find('.');
+        int seconds;
+        if (dot == std::string_view::npos || !parseInt(s.substr(0, dot), seconds))
+            return false;
+        long long fraction = 0;
+        size_t digits = 0;
+        for (size_t k = dot + 1; k < s.size() && isDigit(s[k]); ++k)
+            if (digits < 9) {
+                fraction = fraction * 10 + (s[k] - '0');
+                ++digits;
+            }
+        for (; digits < 9; ++digits)
+            fraction *= 10;
+        ns = seconds * 1000000000LL + fraction;
+        return true;
+    }
+
+    // "comm:pid [prio]" (format compact de perf) : pid et priorité
+    static bool parseCompactTask(std::string_view s, int& pid, int& prio, std::string_view& comm) {
+        size_t bracket = s.find(" [");
+        if (bracket == std::string_view::npos)
+            return false;
+        size_t colon = s.rfind(':', bracket);
+        if (colon == std::string_view::npos || !parseInt(s.substr(colon + 1, bracket - colon - 1), pid))
+            return false;
+        comm = s.substr(0, colon);
+        return parseInt(s.substr(bracket + 2), prio);
+    }
+
+    // Décode une ligne ; false si ce n'est ni un sched_switch ni un sched_wakeup
+    static bool parseLine(std::string_view line, Event& e, bool& malformed) {
+        malformed = false;
+        // Processeur : premier "[nnn]"
+        size_t open = 0;
+        while ((open = line.find('[', open)) != std::string_view::npos) {
+            size_t close = open + 1;
+            while (close < line.size() && isDigit(line[close]))
+                ++close;
+            if (close > open + 1 && close < line.size() && line[close] == ']')
+                break;
+            ++open;
+        }
+        if (open == std::string_view::npos)
+            return false;
+        size_t close = line.find(']', open);
+        parseInt(line.substr(open + 1), e.cpu);
+
+        // Date : le mot qui précède le premier ": " après le processeur
+        size_t colon = line.find(": ", close);
+        if (colon == std::string_view::npos)
+            return false;
+        size_t stamp = line.rfind(' ', colon);
+        if (stamp == std::string_view::npos || stamp < close)
+            return false;
+        // Nom de l'événement, éventuellement préfixé par "sched:" et précédé
+        // de blancs d'alignement (perf sched script)
+        size_t nameEnd = line.find(": ", colon + 2);
+        if (nameEnd == std::string_view::npos)
+            return false;
+        std::string_view name = line.substr(colon + 2, nameEnd - colon - 2);
+        while (!name.empty() && (name.front() == ' ' || name.front() == '\t'))
+            name.remove_prefix(1);
+        if (name.size() > 6 && name.compare(0, 6, "sched:") == 0)
+            name.remove_prefix(6);
+        if (name == "sched_switch")
+            e.isSwitch = true;
+        else if (name == "sched_wakeup" || name == "sched_wakeup_new")
+            e.isSwitch = false;
+        else
+            return false;
+        malformed = true;
+        if (!parseTimestamp(line.substr(stamp + 1, colon - stamp - 1), e.ns))
+            return false;
+        std::string_view fields = line.substr(nameEnd + 2);
+
+        if (!e.isSwitch) {
+            if (fields.compare(0, 5, "comm=") == 0) {
+                size_t pid = fields.find(" pid=");
+                if (pid == std::string_view::npos || !parseInt(fields.substr(pid + 5), e.pid))
+                    return false;
+                e.comm = fields.substr(5, pid - 5);
+                e.prio = 0;
+                field(fields, " prio=", e.prio, pid);
+            } else if (!parseCompactTask(fields, e.pid, e.prio, e.comm)) {
+                return false;
+            }
+            malformed = false;
+            return true;
+        }
+
+        size_t arrow = fields.find(" ==> ");
+        if (arrow == std::string_view::npos)
+            return false;
+        std::string_view prev = fields.substr(0, arrow);
+        std::string_view next = fields.substr(arrow + 5);
+        if (prev.compare(0, 10, "prev_comm=") == 0) {
+            size_t pid = prev.find(" prev_pid=");
+            size_t state = prev.find(" prev_state=");
+            size_t comm = next.find(" next_pid=");
+            if (state == std::string_view::npos || state + 12 >= prev.size() || comm == std::string_view::npos ||
+                next.compare(0, 10, "next_comm=") != 0 ||
+                !field(prev, " prev_pid=", e.prevPid) || !parseInt(next.substr(comm + 10), e.pid))
+                return false;
+            e.prevPrio = e.prio = 0;
+            field(prev, " prev_prio=", e.prevPrio, pid);
+            field(next, " next_prio=", e.prio, comm);
+            e.prevState = prev[state + 12];
+            e.comm = next.substr(10, comm - 10);
+        } else {
+            size_t state = prev.rfind(' ');
+            std::string_view prevComm;
+            if (state == std::string_view::npos || state + 1 >= prev.size() ||
+                !parseCompactTask(prev.substr(0, state), e.prevPid, e.prevPrio, prevComm) ||
+                !parseCompactTask(next, e.pid, e.prio, e.comm))
+                return false;
+            e.prevState = prev[state + 1];
+        }
+        malformed = false;
+        return true;
+    }
+
+    Task* find(int pid) {
+        if (pid <= 0 || static_cast<size_t>(pid) >= taskOf.size() || taskOf[pid] < 0)
+            return nullptr;
+        return &tasks[taskOf[pid]];
+    }
+
+    Task& create(int pid, int priority, std::string_view comm) {
+        if (static_cast<size_t>(pid) >= taskOf.size())
+            taskOf.resize(std::max<size_t>(pid + 1, taskOf.size() * 2), -1);
+        std::uint32_t slot;
+        if (freeTasks.empty()) {
+            slot = static_cast<std::uint32_t>(tasks.size());
+            tasks.emplace_back();
+        } else {
+            slot = freeTasks.back();
+            freeTasks.pop_back();
+            tasks[slot] = Task();
+        }
+        taskOf[pid] = static_cast<std::int32_t>(slot);
+        Task& task = tasks[slot];
+        task.tid = pid;
+        task.priority = priority;
+        task.arrival = task.since = task.lastStop = now;
+        task.comm.assign(comm.data(), comm.size());
+        return task;
+    }
+
+    // La rafale de calcul en cours s'achève (au moins une unité)
+    static void closeBurst(Task& task) {
+        task.bursts.push_back(std::max(1, task.burst));
+        task.burst = 0;
+    }
+
+    // La tâche redevient prête après un sommeil ; un sommeil de durée nulle à
+    // cette résolution prolonge la rafale précédente
+    void wake(Task& task) {
+        if (task.state != Task::Sleeping)
+            return;
+        int io = now - task.since;
+        if (io > 0) {
+            task.bursts.push_back(io);
+        } else {
+            task.burst = task.bursts.back();
+            task.bursts.pop_back();
+        }
+        task.state = Task::Runnable;
+        task.since = now;
+    }
+
+    // Fin de la tâche : elle devient un processus de la charge
+    void retire(Task& task) {
+        int end = now;
+        if (task.state == Task::Running) {
+            task.burst += now - task.since;
+            closeBurst(task);
+        } else if (task.state == Task::Runnable && task.burst > 0) {
+            task.waiting += now - task.since;
+            closeBurst(task);
+        } else {
+            // Endormie, ou réveillée sans avoir repris : ce dernier cycle est ignoré
+            if (task.state == Task::Runnable && !task.bursts.empty())
+                task.bursts.pop_back();
+            end = task.lastStop;
+        }
+        std::uint32_t slot = static_cast<std::uint32_t>(taskOf[task.tid]);
+        taskOf[task.tid] = -1;
+        freeTasks.push_back(slot);
+        if (task.bursts.empty())
+            return; // Jamais exécutée
+        int pid = static_cast<int>(result.processes.size()) + 1;
+        result.processes.addBursts(pid, task.arrival, task.bursts, task.priority);
+        result.tid.push_back(task.tid);
+        result.comm.push_back(std::move(task.comm));
+        result.kernel.record(task.waiting, end - task.arrival, task.firstRun - task.arrival);
+        task.bursts = std::vector<int>();
+    }
+
+    void onWakeup(const Event& e) {
+        if (e.pid <= 0)
+            return;
+        Task* task = find(e.pid);
+        if (task == nullptr)
+            create(e.pid, e.prio, e.comm);
+        else
+            wake(*task);
+    }
+
+    void onSwitch(const Event& e) {
+        if (e.prevPid > 0) {
+            Task* prev = find(e.prevPid);
+            if (prev == nullptr) {
+                // En cours d'exécution depuis le début de la trace
+                prev = &create(e.prevPid, e.prevPrio, std::string_view());
+                prev->arrival = prev->since = prev->firstRun = 0;
+                prev->state = Task::Running;
+            }
+            if (prev->state == Task::Running) {
+                prev->burst += now - prev->since;
+                prev->lastStop = now;
+                prev->since = now;
+                if (e.prevState == 'R') {
+                    prev->state = Task::Runnable;
+                } else if (e.prevState == 'X' || e.prevState == 'Z' || e.prevState == 'x') {
+                    retire(*prev);
+                } else {
+                    closeBurst(*prev);
+                    prev->state = Task::Sleeping;
+                }
+            }
+        }
+        if (e.pid > 0) {
+            Task* next = find(e.pid);
+            if (next == nullptr)
+                next = &create(e.pid, e.prio, e.comm);
+            wake(*next); // Réveil non tracé
+            if (next->state == Task::Runnable) {
+                next->waiting += now - next->since;
+                if (next->firstRun < 0)
+                    next->firstRun = now;
+                next->state = Task::Running;
+                next->since = now;
+            }
+        }
+    }
+
+public:
+    explicit TraceReader(const std::string& filename, long long tickNanoseconds = 1000)
+        : file(filename), tick(std::max(1LL, tickNanoseconds)) {}
+
+    TraceWorkload read() {
+        const char* data = file.data();
+        const char* p = data;
+        const char* end = data + file.size();
+        size_t line = 0;
+        Event e;
+        int maxCpu = 0;
+
+        while (p < end) {
+            const char* eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (eol == nullptr)
+                eol = end;
+            ++line;
+            bool malformed = false;
+            if (*p != '#' && parseLine(std::string_view(p, eol - p), e, malformed)) {
+                if (origin < 0)
+                    origin = e.ns;
+                long long ticks = (e.ns - origin) / tick;
+                if (ticks > INT_MAX)
+                    file.fail("trace trop longue pour une unité de " + std::to_string(tick) + " ns", line);
+                now = std::max(now, static_cast<int>(ticks)); // Légers désordres entre processeurs
+                maxCpu = std::max(maxCpu, e.cpu);
+                if (e.isSwitch)
+                    onSwitch(e);
+                else
+                    onWakeup(e);
+                result.events++;
+            } else if (malformed) {
+                file.fail("événement de l'ordonnanceur illisible", line);
+            }
+            p = eol + 1;
+            if ((line & 0xffff) == 0)
+                file.releaseUpTo(static_cast<size_t>(eol - data));
+        }
+
+        // Les tâches encore vivantes se terminent avec la trace, dans l'ordre de leur pid
+        for (size_t pid = 1; pid < taskOf.size(); ++pid)
+            if (taskOf[pid] >= 0)
+                retire(tasks[taskOf[pid]]);
+        result.cpus = maxCpu + 1;
+        result.bytes = file.size();
+        return std::move(result);
+    }
+};
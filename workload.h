@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include "mapped_file.h"
+
+// Format binaire compact : en-tête de 16 octets puis un enregistrement de
+// trois entiers 32 bits (arrivée, durée, priorité) par processus. Il ne décrit
+// que des processus de calcul pur sans échéance, les E/S et les échéances
+// n'existent qu'en CSV.
+struct WorkloadHeader {
+    char magic[4];       // "PSWL"
+    std::uint32_t version;
+    std::uint64_t count;
+};
+
+struct WorkloadRecord {
+    std::int32_t arrivalTime;
+    std::int32_t burstTime;
+    std::int32_t priority;
+};
+
+static const char workloadMagic[4] = {'P', 'S', 'W', 'L'};
+static const std::uint32_t workloadVersion = 1;
+
+// Lecture en flux d'un fichier de charge (CSV ou binaire) mappé en mémoire.
+// Aucune copie ni allocation par ligne : les champs sont décodés directement
+// dans le mapping, et les pages déjà lues sont rendues au noyau au fur et à
+// mesure pour ne jamais garder tout le texte en mémoire.
+class WorkloadReader {
+private:
+    MappedFile file;
+    const char* data;
+    size_t size;
+    std::vector<int> bursts; // Rafales de la ligne en cours, réutilisées d'une ligne à l'autre
+    int deadline = -1;       // Échéance et période de la ligne en cours (-1 et 0 : aucune)
+    int period = 0;
+
+    [[noreturn]] void fail(const std::string& message, size_t line = 0) const {
+        file.fail(message, line);
+    }
+
+    void releaseUpTo(size_t offset) {
+        file.releaseUpTo(offset);
+    }
+
+    static bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    // Décode un entier signé sans passer par std::string
+    static bool parseInt(const char*& p, const char* end, int& value) {
+        while (p < end && isBlank(*p))
+            ++p;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+            negative = (*p++ == '-');
+        if (p == end || *p < '0' || *p > '9')
+            return false;
+        long long v = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            v = v * 10 + (*p++ - '0');
+            if (v > 0x7fffffffLL)
+                return false;
+        }
+        while (p < end && isBlank(*p))
+            ++p;
+        value = static_cast<int>(negative ? -v : v);
+        return true;
+    }
+
+    // Un sink qui accepte (arrivée, rafales, priorité, échéance, période) reçoit
+    // tout ; un sink (arrivée, rafales, priorité) toutes les rafales, sans
+    // échéance ; un sink (arrivée, durée, priorité) n'accepte que le calcul pur
+    template <typename Sink>
+    void deliver(Sink& sink, int arrival, int priority, size_t line) {
+        if constexpr (std::is_invocable_v<Sink&, int, const std::vector<int>&, int, int, int>) {
+            sink(arrival, static_cast<const std::vector<int>&>(bursts), priority, deadline, period);
+        } else {
+            if (deadline >= 0)
+                fail("les échéances ne sont pas prises en charge ici", line);
+            if constexpr (std::is_invocable_v<Sink&, int, const std::vector<int>&, int>) {
+                sink(arrival, static_cast<const std::vector<int>&>(bursts), priority);
+            } else {
+                if (bursts.size() > 1)
+                    fail("les rafales d'E/S ne sont pas prises en charge ici", line);
+                sink(arrival, bursts[0], priority);
+            }
+        }
+    }
+
+    template <typename Sink>
+    size_t readBinary(Sink& sink) {
+        WorkloadHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.version != workloadVersion)
+            fail("version de format binaire non supportée");
+        if (header.count > (size - sizeof(header)) / sizeof(WorkloadRecord))
+            fail("fichier binaire tronqué");
+
+        const char* p = data + sizeof(header);
+        for (std::uint64_t i = 0; i < header.count; ++i, p += sizeof(WorkloadRecord)) {
+            WorkloadRecord record;
+            std::memcpy(&record, p, sizeof(record));
+            if (record.burstTime <= 0)
+                fail("durée invalide pour l'enregistrement " + std::to_string(i));
+            if (record.arrivalTime < 0)
+                fail("arrivée invalide pour l'enregistrement " + std::to_string(i));
+            bursts.assign(1, record.burstTime);
+            deliver(sink, record.arrivalTime, record.priority, 0);
+            if ((i & 0xffff) == 0)
+                releaseUpTo(static_cast<size_t>(p - data));
+        }
+        return static_cast<size_t>(header.count);
+    }
+
+    // Lignes "arrivée,durée[,priorité[,échéance[,période]]]" ; les lignes vides,
+    // les commentaires (#) et une éventuelle ligne d'en-tête non numérique sont
+    // ignorés. La durée peut être une suite "calcul/E-S/calcul/..." de rafales,
+    // qui commence et finit par un calcul. L'échéance est relative à l'arrivée.
+    template <typename Sink>
+    size_t readCsv(Sink& sink) {
+        const char* p = data;
+        const char* end = data + size;
+        size_t line = 0;
+        size_t count = 0;
+
+        while (p < end) {
+            const char* eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (eol == nullptr)
+                eol = end;
+            ++line;
+
+            const char* q = p;
+            while (q < eol && isBlank(*q))
+                ++q;
+            bool skip = q == eol || *q == '#' ||
+                        (line == 1 && !(*q >= '0' && *q <= '9') && *q != '-' && *q != '+');
+            if (!skip) {
+                int arrival, burst, priority = 0;
+                if (!parseInt(q, eol, arrival) || q == eol || *q++ != ',' || !parseInt(q, eol, burst))
+                    fail("ligne invalide, attendu \"arrivée,durée[,priorité]\"", line);
+                if (arrival < 0)
+                    fail("arrivée invalide, attendu un entier positif ou nul", line);
+                bursts.assign(1, burst);
+                while (q < eol && *q == '/') {
+                    ++q;
+                    if (!parseInt(q, eol, burst))
+                        fail("rafale invalide, attendu \"calcul/E-S/calcul...\"", line);
+                    bursts.push_back(burst);
+                }
+                if (q < eol && (*q++ != ',' || !parseInt(q, eol, priority)))
+                    fail("priorité invalide", line);
+                deadline = -1;
+                period = 0;
+                if (q < eol && (*q++ != ',' || !parseInt(q, eol, deadline) || deadline <= 0))
+                    fail("échéance invalide, attendu un entier strictement positif", line);
+                if (q < eol && (*q++ != ',' || !parseInt(q, eol, period) || period < 0))
+                    fail("période invalide", line);
+                if (q != eol)
+                    fail("champ en trop", line);
+                for (int b : bursts)
+                    if (b <= 0)
+                        fail("la durée doit être strictement positive", line);
+                if (bursts.size() % 2 == 0)
+                    fail("la dernière rafale doit être un calcul", line);
+                deliver(sink, arrival, priority, line);
+                ++count;
+            }
+
+            p = eol + 1;
+            if ((line & 0xffff) == 0)
+                releaseUpTo(static_cast<size_t>(eol - data));
+        }
+        return count;
+    }
+
+public:
+    explicit WorkloadReader(const std::string& filename) : file(filename), data(file.data()), size(file.size()) {}
+
+    bool isBinary() const {
+        return size >= sizeof(WorkloadHeader) && std::memcmp(data, workloadMagic, 4) == 0;
+    }
+
+    // Nombre de processus attendu, pour pré-réserver le stockage : exact pour le
+    // format binaire, extrapolé à partir du premier Mio pour le CSV
+    size_t expectedCount() const {
+        if (size == 0)
+            return 0;
+        if (isBinary()) {
+            WorkloadHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            return static_cast<size_t>(header.count);
+        }
+        size_t sample = size < (1 << 20) ? size : (1 << 20);
+        size_t lines = 0;
+        for (const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', data + sample - p))) != nullptr; ++p)
+            ++lines;
+        if (sample == size)
+            return lines + 1;
+        return static_cast<size_t>(static_cast<double>(lines) * size / sample * 1.05) + 1;
+    }
+
+    // Appelle sink(arrivée, durée, priorité) pour chaque processus, ou
+    // sink(arrivée, rafales, priorité[, échéance, période]) si le sink l'accepte ;
+    // renvoie leur nombre
+    template <typename Sink>
+    size_t read(Sink sink) {
+        if (size == 0)
+            return 0;
+        return isBinary() ? readBinary(sink) : readCsv(sink);
+    }
+};
+
+// Écriture d'un fichier de charge au format binaire compact
+class WorkloadWriter {
+private:
+    std::string path;
+    FILE* file;
+    std::uint64_t count = 0;
+
+public:
+    explicit WorkloadWriter(const std::string& filename) : path(filename) {
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr)
+            throw std::runtime_error(path + ": impossible de créer le fichier");
+        WorkloadHeader header = {{'P', 'S', 'W', 'L'}, workloadVersion, 0};
+        std::fwrite(&header, sizeof(header), 1, file);
+    }
+
+    ~WorkloadWriter() {
+        if (file != nullptr)
+            std::fclose(file);
+    }
+
+    WorkloadWriter(const WorkloadWriter&) = delete;
+    WorkloadWriter& operator=(const WorkloadWriter&) = delete;
+
+    void add(int arrivalTime, int burstTime, int priority) {
+        WorkloadRecord record = {arrivalTime, burstTime, priority};
+        std::fwrite(&record, sizeof(record), 1, file);
+        count++;
+    }
+
+    // Réécrit l'en-tête avec le nombre final d'enregistrements
+    void finish() {
+        WorkloadHeader header = {{'P', 'S', 'W', 'L'}, workloadVersion, count};
+        std::fseek(file, 0, SEEK_SET);
+        std::fwrite(&header, sizeof(header), 1, file);
+        bool ok = std::ferror(file) == 0;
+        ok = std::fclose(file) == 0 && ok;
+        file = nullptr;
+        if (!ok)
+            throw std::runtime_error(path + ": erreur d'écriture");
+    }
+};